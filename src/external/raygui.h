@@ -134,6 +134,12 @@
 *           Includes custom ricons.h header defining a set of custom icons,
 *           this file can be generated using rGuiIcons tool
 *
+*       #define RAYGUI_ICONS_ATLAS
+*           Draw icons from a texture atlas (one DrawTexturePro() call per icon) instead of one rectangle
+*           per icon pixel, atlas is generated from icons data on first icon drawing and regenerated when
+*           icons data changes, GuiUpdateIcons() must be called if icons data is modified directly
+*           NOTE: Not available on RAYGUI_STANDALONE mode
+*
 *       #define RAYGUI_DEBUG_RECS_BOUNDS
 *           Draw control bounds rectangles for debug
 *
@@ -148,6 +154,8 @@
 *                         ADDED: GuiDropdonwBox() properties: DROPDOWN_ARROW_HIDDEN, DROPDOWN_ROLL_UP
 *                         ADDED: GuiListView() property: LIST_ITEMS_BORDER_WIDTH
 *                         ADDED: GuiLoadIconsFromMemory(), used by GuiLoadIcons()
+*                         ADDED: RAYGUI_ICONS_ATLAS, icons drawing using a texture atlas
+*                         ADDED: GuiUpdateIcons(), notify icons data changes (icons atlas regenerated)
 *                         ADDED: Macros for inputs customization, raylib decoupling
 *                         REMOVED: GuiSpinner() from controls list, using BUTTON + VALUEBOX properties
 *                         REMOVED: GuiSliderPro(), functionality was redundant
@@ -782,6 +790,7 @@ RAYGUIAPI void GuiSetIconScale(int scale);                      // Set default i
 RAYGUIAPI unsigned int *GuiGetIcons(void);                      // Get raygui icons data pointer
 RAYGUIAPI char **GuiLoadIcons(const char *fileName, bool loadIconsName); // Load raygui icons file (.rgi) into internal icons data
 RAYGUIAPI char **GuiLoadIconsFromMemory(const unsigned char *fileData, int dataSize, bool loadIconsName); // Load raygui icons file (.rgi) from memory into internal icons data
+RAYGUIAPI void GuiUpdateIcons(void);                            // Notify icons data changed, required after modifying icons data directly (icons atlas)
 RAYGUIAPI void GuiDrawIcon(int iconId, int posX, int posY, int pixelSize, Color color); // Draw icon using pixel size at specified position
 #endif
 
@@ -1442,6 +1451,13 @@ static unsigned int *guiIconsPtr = guiIcons;
     #define RAYGUI_ICON_SIZE             0
 #endif
 
+// NOTE: Icons atlas requires textures loading and drawing, not available on standalone mode
+#if defined(RAYGUI_ICONS_ATLAS) && (defined(RAYGUI_NO_ICONS) || defined(RAYGUI_STANDALONE))
+    #undef RAYGUI_ICONS_ATLAS
+#endif
+
+#define RAYGUI_ICONS_ATLAS_PER_LINE     32      // Icons atlas icons per line (if icons atlas enabled)
+
 // WARNING: Those values define the total size of the style data array,
 // if changed, previous saved styles could become incompatible
 #define RAYGUI_MAX_CONTROLS             16      // Maximum number of controls
@@ -1466,6 +1482,14 @@ static float guiAlpha = 1.0f;                   // Gui controls transparency
 
 static unsigned int guiIconScale = 1;           // Gui icon default scale (if icons enabled)
 
+#if defined(RAYGUI_ICONS_ATLAS)
+static Texture2D guiIconsAtlas = { 0 };         // Gui icons atlas texture, generated from icons data
+static unsigned int *guiIconsAtlasPtr = NULL;   // Gui icons data pointer used to generate icons atlas
+static int guiIconsCount = RAYGUI_ICON_MAX_ICONS; // Gui icons count available on icons data
+static unsigned int guiIconsGeneration = 0;     // Gui icons data generation, increased on icons data changes
+static unsigned int guiIconsAtlasGeneration = 0; // Gui icons data generation used to generate icons atlas
+#endif
+
 static bool guiTooltip = false;                 // Tooltip enabled/disabled
 static const char *guiTooltipPtr = NULL;        // Tooltip string pointer (string provided by user)
 
@@ -1582,6 +1606,10 @@ static void GuiTooltip(Rectangle controlRec);                   // Draw tooltip
 
 static Color GuiFade(Color color, float alpha); // Fade color by an alpha factor
 
+#if defined(RAYGUI_ICONS_ATLAS)
+static void GuiLoadIconsAtlas(void);            // Load icons atlas texture from current icons data
+#endif
+
 //----------------------------------------------------------------------------------
 // Gui Setup Functions Definition
 //----------------------------------------------------------------------------------
@@ -5093,14 +5121,41 @@ char **GuiLoadIconsFromMemory(const unsigned char *fileData, int dataSize, bool
         guiIconsPtr = (unsigned int *)RAYGUI_CALLOC(iconDataSize, 1);
 
         memcpy(guiIconsPtr, fileDataPtr, iconDataSize);
+
+    #if defined(RAYGUI_ICONS_ATLAS)
+        guiIconsCount = (iconCount < RAYGUI_ICON_MAX_ICONS)? iconCount : RAYGUI_ICON_MAX_ICONS;
+        guiIconsGeneration++;
+    #endif
     }
 
     return guiIconsName;
 }
 
-// Draw selected icon using rectangles pixel-by-pixel
+// Notify icons data changed, icons atlas regenerated on next icon drawing
+// NOTE: Only required when icons data is modified directly (i.e. GuiGetIcons() pointer)
+void GuiUpdateIcons(void)
+{
+#if defined(RAYGUI_ICONS_ATLAS)
+    guiIconsGeneration++;
+#endif
+}
+
+// Draw selected icon using rectangles pixel-by-pixel or icons atlas texture (RAYGUI_ICONS_ATLAS)
 void GuiDrawIcon(int iconId, int posX, int posY, int pixelSize, Color color)
 {
+#if defined(RAYGUI_ICONS_ATLAS)
+    // Icons atlas generated on first use, regenerated if icons data pointer or generation changed
+    if ((guiIconsAtlas.id == 0) || (guiIconsAtlasPtr != guiIconsPtr) || (guiIconsAtlasGeneration != guiIconsGeneration)) GuiLoadIconsAtlas();
+
+    if ((iconId >= 0) && (iconId < guiIconsCount) && (guiIconsAtlas.id > 0))
+    {
+        Rectangle source = { (float)((iconId%RAYGUI_ICONS_ATLAS_PER_LINE)*RAYGUI_ICON_SIZE), (float)((iconId/RAYGUI_ICONS_ATLAS_PER_LINE)*RAYGUI_ICON_SIZE),
+                             (float)RAYGUI_ICON_SIZE, (float)RAYGUI_ICON_SIZE };
+        Rectangle dest = { (float)posX, (float)posY, (float)(RAYGUI_ICON_SIZE*pixelSize), (float)(RAYGUI_ICON_SIZE*pixelSize) };
+
+        DrawTexturePro(guiIconsAtlas, source, dest, RAYGUI_CLITERAL(Vector2){ 0, 0 }, 0.0f, GuiFade(color, guiAlpha));
+    }
+#else
     #define BIT_CHECK(a,b) ((a) & (1u<<(b)))
 
     for (int i = 0, y = 0; i < RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE/32; i++)
@@ -5117,7 +5172,50 @@ void GuiDrawIcon(int iconId, int posX, int posY, int pixelSize, Color color)
             if ((k == 15) || (k == 31)) y++;
         }
     }
+#endif
+}
+
+#if defined(RAYGUI_ICONS_ATLAS)
+// Load icons atlas texture from current icons data, RAYGUI_ICONS_ATLAS_PER_LINE icons per line, no padding
+// NOTE: Atlas pixels are white, icon bits set alpha (GRAY_ALPHA), icon color is applied as tint on drawing
+static void GuiLoadIconsAtlas(void)
+{
+    int lines = (guiIconsCount + RAYGUI_ICONS_ATLAS_PER_LINE - 1)/RAYGUI_ICONS_ATLAS_PER_LINE;
+    if (lines <= 0) return;
+
+    Image atlas = { 0 };
+    atlas.width = RAYGUI_ICONS_ATLAS_PER_LINE*RAYGUI_ICON_SIZE;
+    atlas.height = lines*RAYGUI_ICON_SIZE;
+    atlas.mipmaps = 1;
+    atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+    atlas.data = RAYGUI_CALLOC(atlas.width*atlas.height*2, sizeof(unsigned char));
+
+    if (atlas.data == NULL) return;
+
+    unsigned char *pixels = (unsigned char *)atlas.data;
+
+    for (int n = 0; n < guiIconsCount; n++)
+    {
+        int offsetX = (n%RAYGUI_ICONS_ATLAS_PER_LINE)*RAYGUI_ICON_SIZE;
+        int offsetY = (n/RAYGUI_ICONS_ATLAS_PER_LINE)*RAYGUI_ICON_SIZE;
+
+        for (int p = 0; p < RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE; p++)
+        {
+            int index = ((offsetY + p/RAYGUI_ICON_SIZE)*atlas.width + offsetX + p%RAYGUI_ICON_SIZE)*2;
+
+            pixels[index] = 255;
+            if (guiIconsPtr[n*RAYGUI_ICON_DATA_ELEMENTS + p/32] & (1u << (p%32))) pixels[index + 1] = 255;
+        }
+    }
+
+    if (guiIconsAtlas.id > 0) UnloadTexture(guiIconsAtlas);
+    guiIconsAtlas = LoadTextureFromImage(atlas);
+    RAYGUI_FREE(atlas.data);
+
+    guiIconsAtlasPtr = guiIconsPtr;
+    guiIconsAtlasGeneration = guiIconsGeneration;
 }
+#endif
 
 // Set icon drawing size
 void GuiSetIconScale(int scale)
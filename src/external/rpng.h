@@ -1,6 +1,6 @@
 /**********************************************************************************************
 *
-*   rpng v1.5 - A simple and easy-to-use library to manage png chunks
+*   rpng v1.6 - A simple and easy-to-use library to manage png chunks
 *
 *   FEATURES:
 *       - Load/Save images from/to raw image data
@@ -9,9 +9,12 @@
 *       - Operate on file or memory buffer
 *       - Chunks data abstraction
 *       - Add custom chunks
+*       - Chunks editing session, multiple chunks edits written at once
+*       - Multithreaded image data compression (optional)
+*       - Image data streaming, rows decoded one by one to a callback (bounded memory)
 *
 *   LIMITATIONS:
-*       - Bit depths of 1/2/4 bits per pixel not supported, only 8/16 bits
+*       - Bit depths of 1/2/4 bits per pixel only supported for grayscale images, as packed scanlines
 *
 *   POSSIBLE IMPROVEMENTS:
 *       - Support APNG chunks, added to PNG specs recently (draft)
@@ -24,6 +27,7 @@
 *
 *       #define RPNG_DEFLATE_IMPLEMENTATION
 *           Include sdefl/sinfl deflate implementation with rpng
+*           NOTE: sinfl internal functions are always included, required by image data streaming
 *
 *       #define RPNG_NO_STDIO
 *           Do not include FILE I/O API, only read/write from memory buffers
@@ -31,10 +35,24 @@
 *       #define RPNG_NO_STDIO_WARNING
 *           Skips issuing a compiler warning when RPNG_NO_STDIO is defined.
 *
+*       #define RPNG_NO_SIMD
+*           Do not use SIMD intrinsics for scanlines filtering (SSE2) and CRC32 (PCLMULQDQ), even if available
+*
+*       #define RPNG_THREADS
+*           Compress image data using multiple threads (POSIX threads), check rpng_set_thread_count()
+*           NOTE: Uses internal sdefl functions, included even if RPNG_DEFLATE_IMPLEMENTATION is not defined
+*
+*       #define RPNG_MEMORY_STATS
+*           Track memory allocated by the library (current and peak), check rpng_memory_get_peak()
+*           NOTE: Uses default allocators (malloc), data returned by the library must be freed with RPNG_FREE()
+*
 *   DEPENDENCIES: libc (C standard library)
 *       stdlib.h        Required for: malloc(), calloc(), free()
 *       string.h        Required for: memcmp(), memcpy()
 *       stdio.h         Required for: FILE, fopen(), fread(), fwrite(), fclose() (only if !RPNG_NO_STDIO)
+*       emmintrin.h     Required for: SSE2 intrinsics (only if available and !RPNG_NO_SIMD)
+*       wmmintrin.h     Required for: PCLMULQDQ intrinsics, CRC32 (only on x86_64 and !RPNG_NO_SIMD)
+*       pthread.h       Required for: pthread_create(), pthread_join() (only if RPNG_THREADS)
 *
 *       rpng includes internally a copy of sdefl and sinfl libraries by Micha Mettke (@vurtun)
 *       sdelf and sinfl libraries are used for compression and decompression of deflate data streams
@@ -90,6 +108,25 @@
 *       Comment          Miscellaneous comment; conversion from GIF comment
 *
 *   VERSIONS HISTORY:
+*       1.6 (17-Oct-2026) ADDED: rpng_save_image_with_chunks_to_memory(), single pass PNG with chunks
+*                         ADDED: rpng_chunk_gen_comp_text(), zTXt chunk generated in memory
+*                         ADDED: Support grayscale 1/2/4 bit depth images loading/saving (packed scanlines)
+*                         ADDED: rpng_chunk_read_comp_text_from_memory(), zTXt text decompressed
+*                         REVIEWED: Image data unfiltering for Average and Paeth filters
+*                         ADDED: rpng_set_filter_type(), scanlines filter selection configurable
+*                         REVIEWED: Scanlines filters scored in one pass (SSE2), best filter output reused
+*                         REVIEWED: Chunks operations buffers sized from input, no RPNG_MAX_OUTPUT_SIZE allocations
+*                         ADDED: RPNG_MEMORY_STATS, rpng_memory_get_peak() to check memory allocated
+*                         ADDED: rpng_session, chunks edits (add/replace/remove) queued and written at once
+*                         ADDED: rpng_chunk_gen_text(), rpng_chunk_gen_time(), rpng_chunk_gen_physical_size()
+*                         REVIEWED: tIME chunk year saved as big endian
+*                         ADDED: rpng_set_compression_level(), deflate compression level configurable
+*                         ADDED: RPNG_THREADS, rpng_set_thread_count(), image data compressed by scanlines ranges
+*                         REVIEWED: CRC32 computed with slicing-by-8 tables or PCLMULQDQ folding (runtime check)
+*                         ADDED: rpng_load_image_rows() (+ memory version), image data rows streamed to callback
+*                         ADDED: rpng_chunk_check_bounds_from_memory(), chunks checked against buffer size
+*                         REVIEWED: Inflate code lengths repeats and input reading bounded (corrupted data)
+* 
 *       1.5 (28-Aug-2024) ADDED: Support indexed data loading and saving (PLTE, tRNS)
 *                         ADDED: rpng_load_image_indexed() (+ memory version)
 *                         ADDED: rpng_save_image_indexed() (+ memory version)
@@ -132,7 +169,7 @@
 #ifndef RPNG_H
 #define RPNG_H
 
-#define RPNG_VERSION    "1.5"
+#define RPNG_VERSION    "1.6"
 
 // Function specifiers in case library is build/used as a shared library (Windows)
 // NOTE: Microsoft specifiers to tell compiler that symbols are imported/exported from a .dll
@@ -153,6 +190,13 @@
 // Defines and Macros
 //----------------------------------------------------------------------------------
 // Allow custom memory allocators
+// NOTE: RPNG_MEMORY_STATS tracks allocations through internal functions (on top of malloc)
+#if defined(RPNG_MEMORY_STATS) && !defined(RPNG_MALLOC)
+    #define RPNG_MALLOC(sz)         rpng_memory_alloc(sz, 0)
+    #define RPNG_CALLOC(n,sz)       rpng_memory_alloc((n)*(sz), 1)
+    #define RPNG_REALLOC(ptr,sz)    rpng_memory_realloc(ptr, sz)
+    #define RPNG_FREE(ptr)          rpng_memory_free(ptr)
+#endif
 #ifndef RPNG_MALLOC
     #define RPNG_MALLOC(sz)         malloc(sz)
 #endif
@@ -180,17 +224,27 @@
     #define RPNG_MAX_CHUNKS_COUNT   64
 #endif
 #ifndef RPNG_MAX_OUTPUT_SIZE
-    // Maximum size for temporal buffer on write/remove chunks,
-    // buffer is scaled to required output file size before being returned
+    // Maximum size for decompressed data (image data or text),
+    // NOTE: Buffers are sized from input data, it's just a security limit
     #define RPNG_MAX_OUTPUT_SIZE    (64*1024*1024)
 #endif
 
 #ifndef RPNG_COMPRESSION_LEVEL
-    // Deflate compression level
+    // Deflate compression level, default value (it can be changed with rpng_set_compression_level())
     // NOTE: Default to same as stbiw: 8
     #define RPNG_COMPRESSION_LEVEL   8
 #endif
 
+#ifndef RPNG_MAX_THREADS
+    // Maximum number of threads used to compress image data (RPNG_THREADS)
+    #define RPNG_MAX_THREADS        64
+#endif
+#ifndef RPNG_THREADS_MIN_DATA
+    // Minimum filtered image data size (bytes) compressed by every thread (RPNG_THREADS)
+    // NOTE: Smaller images use less threads, image data under 2*RPNG_THREADS_MIN_DATA is compressed by one thread
+    #define RPNG_THREADS_MIN_DATA   (128*1024)
+#endif
+
 // Define some possible error values
 // NOTE: Only some are actually used on file saving
 #define RPNG_SUCCESS                 0      // Image saved successfully
@@ -198,6 +252,18 @@
 #define RPNG_ERROR_PIXEL_FORMAT      2      // Not a supported PNG image format
 #define RPNG_ERROR_MEMORY_ALLOC      3      // Memory could not be allocated for operation
 
+// Deflate compression levels range (sdefl)
+#define RPNG_COMPRESSION_LEVEL_MIN   0      // Fastest compression, bigger output
+#define RPNG_COMPRESSION_LEVEL_MAX   8      // Slowest compression, smaller output
+
+// Scanlines filter types, used on image data saving
+#define RPNG_FILTER_ADAPTIVE        -1      // Best filter selected for every scanline (default)
+#define RPNG_FILTER_NONE             0      // Filter type 0: None
+#define RPNG_FILTER_SUB              1      // Filter type 1: Sub
+#define RPNG_FILTER_UP               2      // Filter type 2: Up
+#define RPNG_FILTER_AVERAGE          3      // Filter type 3: Average
+#define RPNG_FILTER_PAETH            4      // Filter type 4: Paeth
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -228,6 +294,22 @@ typedef struct {
     rpng_color *colors;     // Palette colors
 } rpng_palette;
 
+// Chunks editing session type
+// NOTE: Chunks data points to PNG buffer, chunks added/replaced data is copied (owned by session)
+typedef struct {
+    char *buffer;           // PNG data buffer (loaded from file or provided memory)
+    bool buffer_owned;      // PNG data buffer loaded by session, freed on session close
+    rpng_chunk *chunks;     // Session chunks, in output order
+    bool *chunks_owned;     // Session chunks data owned by session (not pointing to buffer)
+    int count;              // Session chunks count (0 if session is not valid)
+    int capacity;           // Session chunks capacity
+    int insert_position;    // Position for new chunks: after IHDR and previously added chunks
+} rpng_session;
+
+// Image row callback, used on image data streaming, row data is only valid during the callback
+// NOTE: Returning false stops image data decoding
+typedef bool (*rpng_row_callback)(const char *row, int y, void *user_data);
+
 // A minimal PNG only requires: png_signature | rpng_chunk(IHDR) | rpng_chunk(IDAT) | rpng_chunk(IEND)
 
 #ifdef __cplusplus
@@ -246,6 +328,7 @@ extern "C" {                // Prevents name mangling of functions
 // Load a PNG file image data
 //  - Color channels are returned by reference, supported values: 1 (GRAY), 2 (GRAY+ALPHA), 3 (RGB), 4 (RGBA)
 //  - Bit depth is returned by reference, supported values: 8 bit, 16 bit
+//  - Bit depth 1/2/4 bit (GRAY) data is returned as packed scanlines (MSB first, rows padded to byte)
 //  - In case data can not be loaded, returns NULL
 RPNGAPI char *rpng_load_image(const char *filename, int *width, int *height, int *color_channels, int *bit_depth);
 
@@ -254,9 +337,18 @@ RPNGAPI char *rpng_load_image(const char *filename, int *width, int *height, int
 //  - In case image data is not indexed, returns NULL
 RPNGAPI char *rpng_load_image_indexed(const char *filename, int *width, int *height, rpng_palette *palette);
 
+// Load a PNG file image data row by row, rows are provided to callback in order (streaming)
+//  - Image data is decompressed and unfiltered one scanline at a time, no full image buffer allocated,
+//    memory required is compressed data + deflate window (32KB) + a few scanlines
+//  - Row data is provided in the same format as rpng_load_image() (packed scanlines for 1/2/4 bit)
+//  - Image info (width, height, color_channels, bit_depth) is set before first row callback
+//  - Returns number of rows provided to callback, -1 if image data checksum failed after decoding
+RPNGAPI int rpng_load_image_rows(const char *filename, rpng_row_callback callback, void *user_data, int *width, int *height, int *color_channels, int *bit_depth);
+
 // Save a PNG file from image data (IHDR, IDAT, IEND)
 //  - Color channels defines pixel color channels, supported values: 1 (GRAY), 2 (GRAY+ALPHA), 3 (RGB), 4 (RGBA)
 //  - Bit depth defines every color channel size, supported values: 8 bit, 16 bit
+//  - Bit depth 1/2/4 bit supported for GRAY, data provided as packed scanlines (MSB first, rows padded to byte)
 //  - Returns saving process result: 0-SUCCESS
 RPNGAPI int rpng_save_image(const char *filename, const char *data, int width, int height, int color_channels, int bit_depth);
 
@@ -267,11 +359,30 @@ RPNGAPI int rpng_save_image(const char *filename, const char *data, int width, i
 //  - Returns saving process result: 0-SUCCESS
 RPNGAPI int rpng_save_image_indexed(const char *filename, const char *indexed_data, int width, int height, rpng_palette palette);
 
+// Set scanlines filter type used on image data saving
+//  - Supported values: RPNG_FILTER_ADAPTIVE (default), RPNG_FILTER_NONE...RPNG_FILTER_PAETH
+//  - A fixed filter skips the filters scoring for every scanline, faster but usually bigger output
+//  - WARNING: Setting is global, it should be set before saving images from multiple threads
+RPNGAPI void rpng_set_filter_type(int filter_type);
+
+// Set deflate compression level used on image data (IDAT) and compressed text (zTXt) saving
+//  - Supported values: RPNG_COMPRESSION_LEVEL_MIN (0, fastest) to RPNG_COMPRESSION_LEVEL_MAX (8, smallest)
+//  - WARNING: Setting is global, it should be set before saving images from multiple threads
+RPNGAPI void rpng_set_compression_level(int level);
+
+// Set number of threads used to compress image data (IDAT) on saving, requires RPNG_THREADS
+//  - Supported values: 1 (default, no additional threads) to RPNG_MAX_THREADS
+//  - Image data is split in scanlines ranges, output is a standard zlib stream (one deflate block per range at least)
+//  - WARNING: Setting is global, it should be set before saving images from multiple threads
+RPNGAPI void rpng_set_thread_count(int count);
+
 // Load and save png data from memory buffer
 // WARNING: Provided buffer is expected to be PNG compliant, ending with IEND chunk
 RPNGAPI char *rpng_load_image_from_memory(const char *buffer, int *width, int *height, int *color_channels, int *bit_depth); // Load png data from memory buffer
 RPNGAPI char *rpng_load_image_indexed_from_memory(const char *buffer, int *width, int *height, rpng_palette *palette); // Load indexed png data from memory buffer (8 bpp)
+RPNGAPI int rpng_load_image_rows_from_memory(const char *buffer, int size, rpng_row_callback callback, void *user_data, int *width, int *height, int *color_channels, int *bit_depth); // Load png data rows from memory buffer (streaming, buffer size checked)
 RPNGAPI char *rpng_save_image_to_memory(const char *data, int width, int height, int color_channels, int bit_depth, int *output_size); // Save png data to memory buffer
+RPNGAPI char *rpng_save_image_with_chunks_to_memory(const char *data, int width, int height, int color_channels, int bit_depth, const rpng_chunk *chunks, int chunk_count, int *output_size); // Save png data to memory buffer, additional chunks written after IHDR
 RPNGAPI char *rpng_save_image_indexed_to_memory(const char *indexed_data, int width, int height, rpng_palette palette, int *output_size); // Save indexed data to memory buffer
 
 // Convert indexed image data to RGBA data
@@ -297,6 +408,7 @@ RPNGAPI void rpng_chunk_write_chroma(const char *filename, float white_x, float
 // Chunk utilities
 RPNGAPI void rpng_chunk_print_info(const char *filename);                            // Output info about the chunks
 RPNGAPI bool rpng_chunk_check_all_valid(const char *filename);                       // Check chunks CRC is valid
+RPNGAPI bool rpng_chunk_check_bounds_from_memory(const char *buffer, int size);      // Check signature and all chunks (up to IEND) fit into buffer size
 RPNGAPI void rpng_chunk_combine_image_data(const char *filename);                    // Combine multiple IDAT chunks into a single one
 RPNGAPI void rpng_chunk_split_image_data(const char *filename, int split_size);      // Split one IDAT chunk into multiple ones
 
@@ -307,9 +419,37 @@ RPNGAPI rpng_chunk *rpng_chunk_read_all_from_memory(const char *buffer, int *cou
 RPNGAPI char *rpng_chunk_remove_from_memory(const char *buffer, const char *chunk_type, int *output_size);  // Remove one chunk type from memory
 RPNGAPI char *rpng_chunk_remove_ancillary_from_memory(const char *buffer, int *output_size);                // Remove all chunks except: IHDR-IDAT-IEND
 RPNGAPI char *rpng_chunk_write_from_memory(const char *buffer, rpng_chunk chunk, int *output_size);         // Write one new chunk after IHDR (any kind)
+RPNGAPI rpng_chunk rpng_chunk_gen_text(const char *keyword, const char *text);                               // Generate tEXt chunk (chunk.data must be freed)
+RPNGAPI rpng_chunk rpng_chunk_gen_comp_text(const char *keyword, const char *text);                          // Generate zTXt chunk, DEFLATE compressed text (chunk.data must be freed)
+RPNGAPI rpng_chunk rpng_chunk_gen_time(short year, char month, char day, char hour, char min, char sec);     // Generate tIME chunk (chunk.data must be freed)
+RPNGAPI rpng_chunk rpng_chunk_gen_physical_size(int pixels_unit_x, int pixels_unit_y, bool meters);         // Generate pHYs chunk (chunk.data must be freed)
+RPNGAPI char *rpng_chunk_read_comp_text_from_memory(const char *buffer, const char *keyword);                 // Read zTXt chunk text for keyword, decompressed (text must be freed)
 RPNGAPI char *rpng_chunk_combine_image_data_from_memory(char *buffer, int *output_size);                    // Combine multiple IDAT chunks into a single one
 RPNGAPI char *rpng_chunk_split_image_data_from_memory(char *buffer, int split_size, int *output_size);      // Split one IDAT chunk into multiple ones
 
+// Chunks editing session: PNG is read once, chunks edits are queued and written at once on commit
+// NOTE: Added chunks are placed after IHDR (in adding order), chunk data is copied by session
+// WARNING: Memory buffer provided to session must be valid until session is closed
+RPNGAPI rpng_session rpng_session_open(const char *filename);                                               // Open chunks editing session from PNG file
+RPNGAPI rpng_session rpng_session_open_from_memory(const char *buffer);                                     // Open chunks editing session from PNG memory buffer
+RPNGAPI void rpng_session_add_chunk(rpng_session *session, rpng_chunk chunk);                               // Add one new chunk (any kind)
+RPNGAPI void rpng_session_replace_chunk(rpng_session *session, rpng_chunk chunk);                           // Replace chunk type (first found, others removed), added if not found
+RPNGAPI void rpng_session_remove_chunk(rpng_session *session, const char *chunk_type);                      // Remove one chunk type (all chunks found)
+RPNGAPI void rpng_session_remove_ancillary(rpng_session *session);                                          // Remove all chunks except: IHDR-PLTE-IDAT-IEND
+RPNGAPI int rpng_session_commit(rpng_session *session, const char *filename);                               // Write session chunks to PNG file, returns 0-SUCCESS
+RPNGAPI char *rpng_session_commit_to_memory(rpng_session *session, int *output_size);                       // Write session chunks to memory buffer
+RPNGAPI void rpng_session_close(rpng_session *session);                                                     // Close chunks editing session, free memory
+
+// Memory usage stats, only tracked with RPNG_MEMORY_STATS (otherwise returns 0)
+RPNGAPI int rpng_memory_get_current(void);          // Get memory currently allocated by the library (bytes), including not freed returned data
+RPNGAPI int rpng_memory_get_peak(void);             // Get peak memory allocated by the library (bytes)
+RPNGAPI void rpng_memory_reset_peak(void);          // Reset peak memory to current allocated memory
+#if defined(RPNG_MEMORY_STATS)
+RPNGAPI void *rpng_memory_alloc(int size, int zero); // Allocate memory, tracked (used by RPNG_MALLOC/RPNG_CALLOC)
+RPNGAPI void *rpng_memory_realloc(void *ptr, int size); // Reallocate memory, tracked (used by RPNG_REALLOC)
+RPNGAPI void rpng_memory_free(void *ptr);           // Free memory, tracked (used by RPNG_FREE)
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -337,6 +477,39 @@ RPNGAPI char *rpng_chunk_split_image_data_from_memory(char *buffer, int split_si
     #include <unistd.h>     // Required for: access() (POSIX, not C standard) [file_exists()]
 #endif
 
+#if defined(RPNG_THREADS)
+    #include <pthread.h>    // Required for: pthread_create(), pthread_join()
+#endif
+
+// SSE2 support for scanlines filtering, processing 16 bytes per iteration
+#if !defined(RPNG_NO_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define RPNG_SIMD_SSE2
+        #include <emmintrin.h>  // Required for: SSE2 intrinsics
+    #endif
+#endif
+
+// PCLMULQDQ support for CRC32 computation, CPU support checked at runtime (CPUID)
+#if !defined(RPNG_NO_SIMD)
+    #if (defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))) || (defined(_M_X64) && defined(_MSC_VER))
+        #define RPNG_SIMD_CLMUL
+        #include <wmmintrin.h>      // Required for: PCLMULQDQ intrinsics
+        #if defined(_MSC_VER)
+            #include <intrin.h>     // Required for: __cpuid()
+            #define RPNG_TARGET_CLMUL
+        #else
+            #include <cpuid.h>      // Required for: __get_cpuid()
+            #define RPNG_TARGET_CLMUL __attribute__((target("pclmul")))
+        #endif
+    #endif
+#endif
+
+// Zeroed bytes before scanlines copies, so left pixels (a, c) can be read without checks
+#define RPNG_SCANLINE_PADDING   16
+
+// Decompressed data kept on image data streaming, deflate matches can reference up to 32KB back
+#define RPNG_INFLATE_WINDOW_SIZE    32768
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -469,22 +642,90 @@ typedef struct {
 //fcTL: Frame Control
 //fdAT: Frame Data
 
+#if defined(RPNG_THREADS)
+// Image data compression job, one range of filtered scanlines
+// NOTE: Range is compressed as a raw deflate stream, sync flushed if not last range (byte aligned, not final)
+typedef struct {
+    const unsigned char *data;      // Filtered image data (all ranges)
+    int begin;                      // Range begin position in data
+    int end;                        // Range end position in data
+    bool last;                      // Range is the last one, final deflate block
+    unsigned char *output;          // Range compressed data
+    int output_size;                // Range compressed data size
+    unsigned int adler;             // Range data Adler-32 checksum
+    unsigned int crc;               // Range compressed data CRC32
+} rpng_deflate_job;
+#endif
+
+// Image data streaming state, decompressed scanlines are unfiltered and provided one by one
+// NOTE: Decompression buffer keeps deflate window (32KB) and pending scanline data, slided on flush
+typedef struct {
+    unsigned char *buffer;          // Decompression buffer
+    unsigned char *next;            // Next filtered scanline position in buffer (filter type byte)
+    unsigned char *current;         // Current scanline unfiltered
+    unsigned char *previous;        // Previous scanline unfiltered (NULL for first scanline)
+    int scanline_size;              // Scanline size, filter type byte not included
+    int pixel_size;                 // Pixel size (bytes)
+    int height;                     // Image height (scanlines expected)
+    int y;                          // Scanlines provided to callback
+    unsigned int adler;             // Decompressed data Adler-32 checksum
+    rpng_row_callback callback;     // Row callback
+    void *user_data;                // Row callback user data
+} rpng_inflate_stream;
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
 const unsigned char png_signature[8] = { 0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a }; // PNG Signature
 
+static int rpng_filter_type = RPNG_FILTER_ADAPTIVE;     // Scanlines filter type used on image data saving
+static int rpng_compression_level = RPNG_COMPRESSION_LEVEL; // Deflate compression level used on data saving
+#if defined(RPNG_THREADS)
+static int rpng_thread_count = 1;                       // Threads used to compress image data
+#endif
+
+#if defined(RPNG_MEMORY_STATS)
+static long long rpng_memory_current = 0;               // Memory currently allocated (bytes)
+static long long rpng_memory_peak = 0;                  // Memory allocated peak (bytes)
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Internal Functions Declaration
 //----------------------------------------------------------------------------------
 // Prefilter and compress image data (image_data -> IDAT chunk.data)
 static char *rpng_inflate_image_data(char *image_data, int image_data_size, int width, int height, int pixel_size);
 // Decompress and unfilter image data (IDAT chunk.data -> image_data)
-static char *rpng_deflate_image_data(const char *image_data, int image_data_size, int width, int height, int pixel_size, int *output_size, int forced_filter_type);
+// NOTE: IDAT chunk CRC32 (type + data) is also returned, computed on compression
+static char *rpng_deflate_image_data(const char *image_data, int image_data_size, int width, int height, int pixel_size, int *output_size, unsigned int *crc, int forced_filter_type);
+// Decompress and unfilter image data scanline by scanline, rows provided to callback (streaming)
+static int rpng_inflate_image_rows(const char *image_data, int image_data_size, int scanline_size, int height, int pixel_size, rpng_row_callback callback, void *user_data);
+static unsigned char *rpng_inflate_stream_flush(void *stream, unsigned char *out);    // Unfilter complete scanlines, slide decompression buffer
+// Unfilter scanline (filter type byte not included), previous scanline unfiltered required (NULL for first scanline)
+static void rpng_unfilter_scanline(const unsigned char *filtered, const unsigned char *prev, unsigned char *out, int size, int pixel_size, int filter_type);
+// Filter scanline with requested filter (or all filters), filtered scanlines sums returned for selection
+static void rpng_filter_scanline(const unsigned char *cur, const unsigned char *prev, int size, int pixel_size, int filter_type, unsigned char *filtered, int stride, unsigned int *sums);
+#if defined(RPNG_THREADS)
+// Compress data using multiple threads, ranges aligned to rows, output is a zlib stream
+static char *rpng_deflate_data_threaded(const unsigned char *data, int data_size, int row_size, int job_count, int *output_size, unsigned int *crc);
+static void *rpng_deflate_job_process(void *job);                   // Compress data range (thread function)
+static unsigned int rpng_adler32_combine(unsigned int adler1, unsigned int adler2, int size2);    // Combine Adler-32 of two consecutive data blocks
+#endif
 
 // Swap integer from big<->little endian
 static unsigned int swap_endian(unsigned int value);
 static unsigned int compute_crc32(unsigned char *buffer, int size);
+static unsigned int compute_crc32_chunk(const char *type, const char *data, int size);  // Compute CRC32 over chunk type + data
+static unsigned int update_crc32(unsigned int crc, const unsigned char *buffer, int size);
+#if defined(RPNG_THREADS)
+static unsigned int crc32_combine(unsigned int crc1, unsigned int crc2, int size2);          // Combine CRC32 of two consecutive data blocks
+#endif
+#if defined(RPNG_SIMD_CLMUL)
+static bool rpng_cpu_has_clmul(void);                                                        // Check CPU support for PCLMULQDQ
+static unsigned int update_crc32_clmul(unsigned int crc, const unsigned char *buffer, int size);  // Update CRC32 using PCLMULQDQ folding
+#endif
+static int get_buffer_size(const char *buffer);   // Get PNG buffer size (signature + chunks, up to IEND)
+static void rpng_session_insert(rpng_session *session, int position, rpng_chunk chunk);    // Insert chunk into session, data copied
+static void rpng_session_delete(rpng_session *session, int position);                      // Delete chunk from session
 
 // Load/save png file data from/to memory buffer
 static char *load_file_to_buffer(const char *filename, int *bytes_read);
@@ -565,6 +806,12 @@ extern int zsdeflate(struct sdefl *s, void *o, const void *i, int n, int lvl);
 
 #endif /* SDEFL_H_INCLUDED */
 
+#if defined(RPNG_THREADS)
+// sdefl internal functions used by threaded compression: data range compression and Adler-32
+static int sdefl_compr(struct sdefl *s, unsigned char *out, const unsigned char *in, int in_begin, int in_len, int lvl, int is_last);
+static unsigned sdefl_adler32(unsigned adler32, const unsigned char *in, int in_len);
+#endif
+
 //=========================================================================
 //                           SINFL
 // DEFLATE DECOMPRESSION algorithm: https://github.com/vurtun/lib/sinfl.h
@@ -579,6 +826,7 @@ extern "C" {
 #define SINFL_PRE_TBL_SIZE 128
 #define SINFL_LIT_TBL_SIZE 1334
 #define SINFL_OFF_TBL_SIZE 402
+#define SINFL_FLUSH_MARGIN 512 /* rpng: output space required to decode one symbol (match + simd copy) */
 
 struct sinfl {
   const unsigned char *bitptr;
@@ -598,6 +846,12 @@ extern int zsinflate(void *out, int cap, const void *in, int size);
 
 #endif /* SINFL_H_INCLUDED */
 
+// sinfl internal functions used by image data streaming: decompression with output flush and Adler-32
+// NOTE: Flush function is called when output buffer is almost full, it must return new output position
+typedef unsigned char *(*sinfl_flush_func)(void *user, unsigned char *out);
+static int sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size, sinfl_flush_func flush, void *user);
+static unsigned sinfl_adler32(unsigned adler32, const unsigned char *in, int in_len);
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition
 //----------------------------------------------------------------------------------
@@ -622,6 +876,32 @@ static unsigned char rpng_paeth_predictor(int a, int b, int c)
     return pr;
 }
 
+// Set scanlines filter type used on image data saving
+void rpng_set_filter_type(int filter_type)
+{
+    if ((filter_type >= RPNG_FILTER_ADAPTIVE) && (filter_type <= RPNG_FILTER_PAETH)) rpng_filter_type = filter_type;
+    else RPNG_LOG("WARNING: Filter type not supported: %i\n", filter_type);
+}
+
+// Set deflate compression level used on data saving
+void rpng_set_compression_level(int level)
+{
+    if ((level >= RPNG_COMPRESSION_LEVEL_MIN) && (level <= RPNG_COMPRESSION_LEVEL_MAX)) rpng_compression_level = level;
+    else RPNG_LOG("WARNING: Compression level not supported: %i\n", level);
+}
+
+// Set number of threads used to compress image data
+void rpng_set_thread_count(int count)
+{
+#if defined(RPNG_THREADS)
+    if ((count >= 1) && (count <= RPNG_MAX_THREADS)) rpng_thread_count = count;
+    else RPNG_LOG("WARNING: Threads count not supported: %i\n", count);
+#else
+    (void)count;
+    RPNG_LOG("WARNING: Threads not supported, RPNG_THREADS not defined\n");
+#endif
+}
+
 // Load a PNG file image data
 //  - Color channels are returned by reference, supported values: 1 (GRAY), 2 (GRAY+ALPHA), 3 (RGB), 4 (RGBA)
 //  - Bit depth is returned by reference, supported values: 8 bit, 16 bit
@@ -641,6 +921,23 @@ char *rpng_load_image(const char *filename, int *width, int *height, int *color_
     return data;
 }
 
+// Load a PNG file image data row by row, rows are provided to callback in order (streaming)
+int rpng_load_image_rows(const char *filename, rpng_row_callback callback, void *user_data, int *width, int *height, int *color_channels, int *bit_depth)
+{
+    int rows = 0;
+
+    int file_size = 0;
+    char *file_data = load_file_to_buffer(filename, &file_size);
+
+    if (file_data != NULL)
+    {
+        rows = rpng_load_image_rows_from_memory(file_data, file_size, callback, user_data, width, height, color_channels, bit_depth);
+        RPNG_FREE(file_data);
+    }
+
+    return rows;
+}
+
 // Load a PNG file image data indexed (including palette)
 //  - Returns indexed data as an index byte array (8bit) along the palette data (PLTE - RGB888 - 24bit)
 // WARNING: In case data is not indexed, returns NULL for pointers and sets values to 0
@@ -835,19 +1132,7 @@ void rpng_chunk_write_text(const char *filename, char *keyword, char *text)
 
     if (file_data != NULL)
     {
-        rpng_chunk chunk = { 0 };
-
-        int keyword_len = (int)strlen(keyword);
-        int text_len = (int)strlen(text);
-
-        // Fill chunk with required data
-        // NOTE: CRC can be left to 0, it's calculated internally on writing
-        memcpy(chunk.type, "tEXt", 4);
-        chunk.length = keyword_len + 1 + text_len;
-        chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
-        memcpy(chunk.data, keyword, keyword_len);
-        memcpy(chunk.data + keyword_len + 1, text, text_len);
-        chunk.crc = 0;  // Computed by rpng_chunk_write_from_memory()
+        rpng_chunk chunk = rpng_chunk_gen_text(keyword, text);
 
         int file_output_size = 0;
         char *file_output = rpng_chunk_write_from_memory(file_data, chunk, &file_output_size);
@@ -874,26 +1159,7 @@ void rpng_chunk_write_comp_text(const char *filename, char *keyword, char *text)
 
     if (file_data != NULL)
     {
-        // Create chunk and fill with data
-        rpng_chunk chunk = { 0 };
-
-        int keyword_len = (int)strlen(keyword);
-        int text_len = (int)strlen(text);
-
-        // Compress filtered image data and generate a valid zlib stream
-        struct sdefl *sde = (struct sdefl *)RPNG_CALLOC(sizeof(struct sdefl), 1);
-        int bounds = sdefl_bound(text_len);
-        unsigned char *comp_text = (unsigned char *)RPNG_CALLOC(bounds, 1);
-        int comp_text_size = zsdeflate(sde, comp_text, (unsigned char *)text, text_len, RPNG_COMPRESSION_LEVEL);
-        RPNG_FREE(sde);
-
-        // Fill chunk with required data
-        // NOTE: CRC can be left to 0, it's calculated internally on writing
-        memcpy(chunk.type, "zTXt", 4);
-        chunk.length = keyword_len + 1 + 1 + comp_text_size;
-        chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
-        memcpy(chunk.data, keyword, keyword_len);
-        memcpy(chunk.data + keyword_len + 2, comp_text, comp_text_size);
+        rpng_chunk chunk = rpng_chunk_gen_comp_text(keyword, text);
 
         int file_output_size = 0;
         char *file_output = rpng_chunk_write_from_memory(file_data, chunk, &file_output_size);
@@ -903,7 +1169,6 @@ void rpng_chunk_write_comp_text(const char *filename, char *keyword, char *text)
         else RPNG_LOG("WARNING: Failed to save file, output size not matching expected size\n");
 
         RPNG_FREE(chunk.data);
-        RPNG_FREE(comp_text);
         RPNG_FREE(file_output);
         RPNG_FREE(file_data);
     }
@@ -992,20 +1257,7 @@ void rpng_chunk_write_time(const char *filename, short year, char month, char da
     int file_size = 0;
     char *file_data = load_file_to_buffer(filename, &file_size);
 
-    rpng_chunk chunk = { 0 };
-
-    // Fill chunk with required data
-    // NOTE: CRC can be left to 0, it's calculated internally on writing
-    memcpy(chunk.type, "tIME", 4);
-    chunk.length = 7;
-    chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
-    memcpy(chunk.data, &year, 2);
-    memcpy(chunk.data + 2, &month, 1);
-    memcpy(chunk.data + 3, &day, 1);
-    memcpy(chunk.data + 4, &hour, 1);
-    memcpy(chunk.data + 5, &min, 1);
-    memcpy(chunk.data + 6, &sec, 1);
-    chunk.crc = 0;  // Computed by rpng_chunk_write_from_memory()
+    rpng_chunk chunk = rpng_chunk_gen_time(year, month, day, hour, min, sec);
 
     int file_output_size = 0;
     char *file_output = rpng_chunk_write_from_memory(file_data, chunk, &file_output_size);
@@ -1029,20 +1281,7 @@ void rpng_chunk_write_physical_size(const char *filename, int pixels_unit_x, int
     int file_size = 0;
     char *file_data = load_file_to_buffer(filename, &file_size);
 
-    rpng_chunk chunk = { 0 };
-
-    // Fill chunk with required data
-    // NOTE: CRC can be left to 0, it's calculated internally on writing
-    memcpy(chunk.type, "pHYs", 4);
-    chunk.length = 9;
-    chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
-    pixels_unit_x = swap_endian(pixels_unit_x);
-    memcpy(chunk.data, &pixels_unit_x, 4);
-    pixels_unit_y = swap_endian(pixels_unit_y);
-    memcpy(chunk.data + 4, &pixels_unit_y, 4);
-    char meters_value = (meters)? 1 : 0;
-    memcpy(chunk.data + 8, &meters_value, 1);
-    chunk.crc = 0;  // Computed by rpng_chunk_write_from_memory()
+    rpng_chunk chunk = rpng_chunk_gen_physical_size(pixels_unit_x, pixels_unit_y, meters);
 
     int file_output_size = 0;
     char *file_output = rpng_chunk_write_from_memory(file_data, chunk, &file_output_size);
@@ -1149,23 +1388,17 @@ bool rpng_chunk_check_all_valid(const char *filename)
     if (chunks == NULL) return false;
 
     unsigned int crc = 0;
-    char *chunk_type_data = (char *)RPNG_CALLOC(RPNG_MAX_OUTPUT_SIZE, 1);
 
-    if (chunk_type_data != NULL)
+    for (int i = 0; i < count; i++)
     {
-        for (int i = 0; i < count; i++)
-        {
-            memcpy(chunk_type_data, chunks[i].type, 4);
-            memcpy(chunk_type_data + 4, chunks[i].data, chunks[i].length);
-            crc = compute_crc32((unsigned char *)chunk_type_data, 4 + chunks[i].length);
-            crc = swap_endian(crc);
+        crc = compute_crc32_chunk(chunks[i].type, chunks[i].data, chunks[i].length);
+        crc = swap_endian(crc);
 
-            // Check computed CRC matches provided CRC
-            if (chunks[i].crc != crc)
-            {
-                result = false;
-                break;
-            }
+        // Check computed CRC matches provided CRC
+        if (chunks[i].crc != crc)
+        {
+            result = false;
+            break;
         }
     }
 
@@ -1249,8 +1482,8 @@ char *rpng_load_image_from_memory(const char *buffer, int *width, int *height, i
         default: break;
     }
 
-    // TODO: Support bit depths of 1/2/4 bits? -> Convert to 8bit grayscale
-    if ((*color_channels == 1) && (*bit_depth != 8) && (*bit_depth != 16)) return data;  // Bit depth 1/2/4 not supported
+    // NOTE: Bit depths of 1/2/4 bits are returned as packed scanlines, unfiltered byte by byte
+    bool packed = ((*color_channels == 1) && (*bit_depth < 8));
 
     // Additional info provided by IHDR (in case it was required)
     //IHDRData->compression;        // Compression method: 0 (DEFLATE)
@@ -1265,17 +1498,19 @@ char *rpng_load_image_from_memory(const char *buffer, int *width, int *height, i
         if (chunk_image.data != NULL)
         {
             // Verify data integrity CRC over all chunk data concatenated
-            unsigned int crc = 0;
-            char *chunk_type_data = (char *)RPNG_CALLOC(4 + chunk_image.length, 1);
-            memcpy(chunk_type_data, chunk_image.type, 4);
-            memcpy(chunk_type_data + 4, chunk_image.data, chunk_image.length);
-            crc = compute_crc32((unsigned char *)chunk_type_data, 4 + chunk_image.length);
-            RPNG_FREE(chunk_type_data);
+            unsigned int crc = compute_crc32_chunk(chunk_image.type, chunk_image.data, chunk_image.length);
 
             if (crc == chunk_image.crc) // Validate crc
             {
                 int pixel_size = *color_channels*(*bit_depth/8);
-                data = rpng_inflate_image_data(chunk_image.data, chunk_image.length, *width, *height, pixel_size);
+                int scanline_size = *width*pixel_size;
+                if (packed)
+                {
+                    pixel_size = 1;
+                    scanline_size = (*width*(*bit_depth) + 7)/8;
+                }
+
+                data = rpng_inflate_image_data(chunk_image.data, chunk_image.length, scanline_size/pixel_size, *height, pixel_size);
 
                 if (data == NULL) RPNG_LOG("WARNING: IDAT image data decompression failed\n");
             }
@@ -1291,6 +1526,86 @@ char *rpng_load_image_from_memory(const char *buffer, int *width, int *height, i
     return data;
 }
 
+// Load png data rows from memory buffer, rows are provided to callback in order (streaming)
+// NOTE: Only compressed image data is loaded (IDAT chunks joined), scanlines decompressed on demand,
+// buffer chunks are checked against buffer size before reading, truncated data is not loaded
+int rpng_load_image_rows_from_memory(const char *buffer, int size, rpng_row_callback callback, void *user_data, int *width, int *height, int *color_channels, int *bit_depth)
+{
+    int rows = 0;
+    *width = 0;
+    *height = 0;
+    *color_channels = 0;
+    *bit_depth = 0;
+
+    if ((callback == NULL) || !rpng_chunk_check_bounds_from_memory(buffer, size))
+    {
+        RPNG_LOG("WARNING: PNG data not valid or truncated\n");
+        return rows;
+    }
+
+    rpng_chunk chunk_info = rpng_chunk_read_from_memory(buffer, "IHDR");
+
+    if ((chunk_info.data == NULL) || (chunk_info.length < 13))
+    {
+        RPNG_FREE(chunk_info.data);
+        return rows;
+    }
+
+    rpng_chunk_IHDR *IHDRData = (rpng_chunk_IHDR *)chunk_info.data;
+
+    *width = swap_endian(IHDRData->width);      // Image width
+    *height = swap_endian(IHDRData->height);    // Image height
+    *bit_depth = IHDRData->bit_depth;           // Bit depth
+
+    *color_channels = 0;
+    switch (IHDRData->color_type)
+    {
+        case 0: *color_channels = 1; break;     // Pixel format: 0-Grayscale
+        case 4: *color_channels = 2; break;     // Pixel format: 4-GrayAlpha
+        case 2: *color_channels = 3; break;     // Pixel format: 2-RGB
+        case 6: *color_channels = 4; break;     // Pixel format: 6-RGBA
+        case 3: *color_channels = 1; break;     // Pixel format: 3-Indexed (1 channel containing 8-bit indexed data)
+        default: break;
+    }
+
+    // NOTE: Bit depths of 1/2/4 bits are provided as packed scanlines, unfiltered byte by byte
+    bool packed = ((*color_channels == 1) && (*bit_depth < 8));
+
+    // NOTE: Scanline size must fit into an int (width*8 bytes per pixel max)
+    if ((*color_channels != 0) && (*width > 0) && (*height > 0) && (*width <= (0x7fffffff/8 - 1)))
+    {
+        // NOTE: All splitted chunks are joined on reading
+        rpng_chunk chunk_image = rpng_chunk_read_from_memory(buffer, "IDAT");
+
+        if (chunk_image.data != NULL)
+        {
+            // Verify data integrity CRC over all chunk data concatenated
+            unsigned int crc = compute_crc32_chunk(chunk_image.type, chunk_image.data, chunk_image.length);
+
+            if (crc == chunk_image.crc) // Validate crc
+            {
+                int pixel_size = *color_channels*(*bit_depth/8);
+                int scanline_size = *width*pixel_size;
+                if (packed)
+                {
+                    pixel_size = 1;
+                    scanline_size = (*width*(*bit_depth) + 7)/8;
+                }
+
+                rows = rpng_inflate_image_rows(chunk_image.data, chunk_image.length, scanline_size, *height, pixel_size, callback, user_data);
+            }
+            else RPNG_LOG("WARNING: CRC not valid, IDAT chunk image data could be corrupted\n");
+        }
+
+        RPNG_FREE(chunk_image.data);
+    }
+    else RPNG_LOG("WARNING: Failed to load file, image pixel format not supported\n");
+
+    RPNG_FREE(chunk_info.data);
+
+    return rows;
+}
+
 // Load indexed png data (including palette) from memory buffer
 // NOTE: Returns indexed data as an index byte array (8bit) along the palette data (PLTE - RGB888 - 24bit)
 char *rpng_load_image_indexed_from_memory(const char *buffer, int *width, int *height, rpng_palette *palette)
@@ -1347,12 +1662,7 @@ char *rpng_load_image_indexed_from_memory(const char *buffer, int *width, int *h
             if (chunk_image.data != NULL)
             {
                 // Verify data integrity CRC over all chunk data concatenated
-                unsigned int crc = 0;
-                char *chunk_type_data = (char *)RPNG_CALLOC(4 + chunk_image.length, 1);
-                memcpy(chunk_type_data, chunk_image.type, 4);
-                memcpy(chunk_type_data + 4, chunk_image.data, chunk_image.length);
-                crc = compute_crc32((unsigned char *)chunk_type_data, 4 + chunk_image.length);
-                RPNG_FREE(chunk_type_data);
+                unsigned int crc = compute_crc32_chunk(chunk_image.type, chunk_image.data, chunk_image.length);
 
                 if (crc == chunk_image.crc) // Validate crc
                 {
@@ -1375,14 +1685,25 @@ char *rpng_load_image_indexed_from_memory(const char *buffer, int *width, int *h
 
 // Save png data to memory buffer
 char *rpng_save_image_to_memory(const char *data, int width, int height, int color_channels, int bit_depth, int *output_size)
+{
+    return rpng_save_image_with_chunks_to_memory(data, width, height, color_channels, bit_depth, NULL, 0, output_size);
+}
+
+// Save png data to memory buffer, additional chunks written after IHDR
+// NOTE: Chunks are written in provided order and CRC is computed internally,
+// useful to generate a complete PNG (i.e. with text chunks) in a single pass
+char *rpng_save_image_with_chunks_to_memory(const char *data, int width, int height, int color_channels, int bit_depth, const rpng_chunk *chunks, int chunk_count, int *output_size)
 {
     char *output_buffer = NULL;
     int output_buffer_size = 0;
 
-    if ((bit_depth != 8) && (bit_depth != 16))
+    // NOTE: Bit depth 1/2/4 only supported for grayscale images
+    bool packed = ((color_channels == 1) && ((bit_depth == 1) || (bit_depth == 2) || (bit_depth == 4)));
+
+    if ((bit_depth != 8) && (bit_depth != 16) && !packed)
     {
         RPNG_LOG("WARNING: Requested bit depth (%i bit per channel) not supported\n", bit_depth);
-        return output_buffer;  // WARNING: Bit depth 1/2/4 not supported
+        return output_buffer;
     }
 
     int color_type = -1;
@@ -1400,14 +1721,26 @@ char *rpng_save_image_to_memory(const char *data, int width, int height, int col
     image_info.color_type = (unsigned char)color_type;
 
     // Image data pre-processing to append filter type byte to every scanline
+    // NOTE: Packed scanlines (bit depth < 8) are filtered byte by byte, as scanlines of 1 byte pixels
     int pixel_size = color_channels*(bit_depth/8);
+    int scanline_size = width*pixel_size;
+    if (packed)
+    {
+        pixel_size = 1;
+        scanline_size = (width*bit_depth + 7)/8;
+    }
+
     int comp_data_size = 0;
-    char *comp_data = rpng_deflate_image_data(data, width*height*pixel_size, width, height, pixel_size, &comp_data_size, -1);
+    unsigned int crc_IDAT = 0;
+    char *comp_data = rpng_deflate_image_data(data, scanline_size*height, scanline_size/pixel_size, height, pixel_size, &comp_data_size, &crc_IDAT, -1);
 
     // Security check to verify compression worked
     if ((comp_data != NULL) && (comp_data_size > 0))
     {
-        output_buffer = (char *)RPNG_CALLOC(8 + 13 + 12 + (comp_data_size + 12) + 12, 1); // Signature + IHDR + IDAT + IEND
+        int chunks_size = 0;
+        for (int i = 0; i < chunk_count; i++) chunks_size += (chunks[i].length + 12);
+
+        output_buffer = (char *)RPNG_CALLOC(8 + 13 + 12 + chunks_size + (comp_data_size + 12) + 12, 1); // Signature + IHDR + chunks + IDAT + IEND
 
         // Write PNG signature
         memcpy(output_buffer, png_signature, 8);
@@ -1423,14 +1756,26 @@ char *rpng_save_image_to_memory(const char *data, int width, int height, int col
         memcpy(output_buffer + 8 + 8 + 13, &crc, 4);
         output_buffer_size += (8 + 12 + 13);
 
+        // Write additional PNG chunks (before IDAT)
+        for (int i = 0; i < chunk_count; i++)
+        {
+            unsigned int length = swap_endian((unsigned int)chunks[i].length);
+            memcpy(output_buffer + output_buffer_size, &length, 4);
+            memcpy(output_buffer + output_buffer_size + 4, chunks[i].type, 4);
+            if (chunks[i].length > 0) memcpy(output_buffer + output_buffer_size + 8, chunks[i].data, chunks[i].length);
+            crc = compute_crc32((unsigned char *)output_buffer + output_buffer_size + 4, 4 + chunks[i].length);
+            crc = swap_endian(crc);
+            memcpy(output_buffer + output_buffer_size + 8 + chunks[i].length, &crc, 4);
+            output_buffer_size += (chunks[i].length + 12);
+        }
+
         // Write PNG chunk IDAT
         unsigned int length_IDAT = comp_data_size;
         length_IDAT = swap_endian(length_IDAT);
         memcpy(output_buffer + output_buffer_size, &length_IDAT, 4);
         memcpy(output_buffer + output_buffer_size + 4, "IDAT", 4);
         memcpy(output_buffer + output_buffer_size + 8, comp_data, comp_data_size);
-        crc = compute_crc32((unsigned char *)output_buffer + output_buffer_size + 4, 4 + comp_data_size);
-        crc = swap_endian(crc);
+        crc = swap_endian(crc_IDAT);     // NOTE: Computed on compression, no need to hash data again
         memcpy(output_buffer + output_buffer_size + 8 + comp_data_size, &crc, 4);
         output_buffer_size += (comp_data_size + 12);
 
@@ -1461,7 +1806,8 @@ char *rpng_save_image_indexed_to_memory(const char *indexed_data, int width, int
     // Image data pre-processing to append filter type byte to every scanline
     int pixel_size = 1; // 1 byte per pixel (indexed data)
     int comp_data_size = 0;
-    char *comp_data = rpng_deflate_image_data(indexed_data, width*height*pixel_size, width, height, pixel_size, &comp_data_size, 0);
+    unsigned int crc_IDAT = 0;
+    char *comp_data = rpng_deflate_image_data(indexed_data, width*height*pixel_size, width, height, pixel_size, &comp_data_size, &crc_IDAT, 0);
 
     // Security check to verify compression worked
     if ((comp_data != NULL) && (comp_data_size > 0))
@@ -1535,8 +1881,7 @@ char *rpng_save_image_indexed_to_memory(const char *indexed_data, int width, int
         memcpy(output_buffer + output_buffer_size, &length_IDAT, 4);
         memcpy(output_buffer + output_buffer_size + 4, "IDAT", 4);
         memcpy(output_buffer + output_buffer_size + 8, comp_data, comp_data_size);
-        crc = compute_crc32((unsigned char *)output_buffer + output_buffer_size + 4, 4 + comp_data_size);
-        crc = swap_endian(crc);
+        crc = swap_endian(crc_IDAT);     // NOTE: Computed on compression, no need to hash data again
         memcpy(output_buffer + output_buffer_size + 8 + comp_data_size, &crc, 4);
         output_buffer_size += (comp_data_size + 12);
 
@@ -1606,6 +1951,31 @@ int rpng_chunk_count_from_memory(const char *buffer)
     return count;
 }
 
+// Check PNG signature and all chunks (up to IEND) fit into buffer size
+// NOTE: Chunks reading from memory expects a valid buffer ending with IEND chunk, this check
+// is required before reading a buffer not generated by rpng (i.e. files provided by user)
+bool rpng_chunk_check_bounds_from_memory(const char *buffer, int size)
+{
+    if ((buffer == NULL) || (size < (8 + 12)) || (memcmp(buffer, png_signature, 8) != 0)) return false;
+
+    const unsigned char *buffer_ptr = (const unsigned char *)buffer;
+    long long offset = 8;
+
+    // NOTE: Every chunk: length (4 bytes) + type (4 bytes) + data (length bytes) + crc (4 bytes)
+    while ((offset + 12) <= size)
+    {
+        unsigned int chunk_size = ((unsigned int)buffer_ptr[offset] << 24) | ((unsigned int)buffer_ptr[offset + 1] << 16) |
+                                  ((unsigned int)buffer_ptr[offset + 2] << 8) | (unsigned int)buffer_ptr[offset + 3];
+
+        if ((chunk_size > 0x7fffffff) || ((offset + 12 + chunk_size) > size)) return false;
+        if (memcmp(buffer_ptr + offset + 4, "IEND", 4) == 0) return true;
+
+        offset += (12 + chunk_size);
+    }
+
+    return false;
+}
+
 // Read one chunk type from memory buffer
 rpng_chunk rpng_chunk_read_from_memory(const char *buffer, const char *chunk_type)
 {
@@ -1621,14 +1991,31 @@ rpng_chunk rpng_chunk_read_from_memory(const char *buffer, const char *chunk_typ
         // In case chunk(s) requested is IDAT, all IDAT chunks are concatenated
         if (memcmp(chunk_type, "IDAT", 4) == 0)
         {
-            char *idat_data_concat = (char *)RPNG_CALLOC(RPNG_MAX_OUTPUT_SIZE, sizeof(char));
+            // Compute size for all IDAT chunks data, to be concatenated
+            char *idat_ptr = buffer_ptr;
             int idat_data_concat_size = 0;
 
+            while (memcmp(idat_ptr + 4, "IEND", 4) != 0) // While IEND chunk not reached
+            {
+                if (memcmp(idat_ptr + 4, chunk_type, 4) == 0) idat_data_concat_size += chunk_size;
+
+                idat_ptr += (4 + 4 + chunk_size + 4); // Move pointer to next chunk of input data
+                chunk_size = swap_endian(((int *)idat_ptr)[0]); // Compute next chunk file_size
+            }
+
+            // Fill chunk data with all accumulated IDAT
+            chunk.length = idat_data_concat_size;
+            memcpy(chunk.type, "IDAT", 4);
+            // NOTE: Some extra zeroed bytes are allocated, inflate could read some bytes after input data (8 bytes at once)
+            chunk.data = (char *)RPNG_CALLOC(idat_data_concat_size + 16, sizeof(char));
+            idat_data_concat_size = 0;
+            chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+
             while (memcmp(buffer_ptr + 4, "IEND", 4) != 0) // While IEND chunk not reached
             {
                 if (memcmp(buffer_ptr + 4, chunk_type, 4) == 0) // Check next IDAT chunk
                 {
-                    memcpy(idat_data_concat + idat_data_concat_size, (char *)(buffer_ptr + 8), chunk_size);
+                    memcpy(chunk.data + idat_data_concat_size, (char *)(buffer_ptr + 8), chunk_size);
                     idat_data_concat_size += chunk_size;
 
                     // TODO: Validate every IDAT chunk CRC32
@@ -1638,19 +2025,8 @@ rpng_chunk rpng_chunk_read_from_memory(const char *buffer, const char *chunk_typ
                 chunk_size = swap_endian(((int *)buffer_ptr)[0]); // Compute next chunk file_size
             }
 
-            // Fill chunk data with all accumulated IDAT
-            chunk.length = idat_data_concat_size;
-            memcpy(chunk.type, "IDAT", 4);
-            chunk.data = (char *)RPNG_CALLOC(idat_data_concat_size, sizeof(char));
-            memcpy(chunk.data, idat_data_concat, idat_data_concat_size);
-            RPNG_FREE(idat_data_concat);
-
             // Compute CRC32 for security
-            unsigned char *chunk_type_data = (unsigned char *)RPNG_CALLOC(4 + chunk.length, 1);
-            memcpy(chunk_type_data, chunk.type, 4);
-            memcpy(chunk_type_data + 4, chunk.data, chunk.length);
-            chunk.crc = compute_crc32(chunk_type_data, 4 + chunk.length);
-            RPNG_FREE(chunk_type_data);
+            chunk.crc = compute_crc32_chunk(chunk.type, chunk.data, chunk.length);
         }
         else // Only one chunk required, not IDAT type
         {
@@ -1686,8 +2062,10 @@ rpng_chunk *rpng_chunk_read_all_from_memory(const char *buffer, int *count)
     // NOTE: We check minimum file_size for a PNG (Signature + chunk IHDR + chunk IDAT + chunk IEND)
     if ((buffer_ptr != NULL) && (memcmp(buffer_ptr, png_signature, 8) == 0))  // Check valid PNG file signature
     {
-        // We allocate enough space for 64 chunks
-        chunks = (rpng_chunk *)RPNG_CALLOC(RPNG_MAX_CHUNKS_COUNT, sizeof(rpng_chunk));
+        // We allocate space for the chunks available (limited to RPNG_MAX_CHUNKS_COUNT)
+        int chunk_count = rpng_chunk_count_from_memory(buffer);
+        if (chunk_count > RPNG_MAX_CHUNKS_COUNT) chunk_count = RPNG_MAX_CHUNKS_COUNT;
+        chunks = (rpng_chunk *)RPNG_CALLOC(chunk_count, sizeof(rpng_chunk));
         buffer_ptr += 8; // Move pointer after signature
 
         unsigned int chunk_size = swap_endian(((int *)buffer_ptr)[0]);
@@ -1704,7 +2082,7 @@ rpng_chunk *rpng_chunk_read_all_from_memory(const char *buffer, int *count)
             chunk_size = swap_endian(((int *)buffer_ptr)[0]);
 
             counter++;
-            if (counter >= (RPNG_MAX_CHUNKS_COUNT - 2)) break;   // WARNING: Too many chunks!
+            if (counter >= (chunk_count - 1)) break;   // WARNING: Too many chunks! (keep space for IEND)
         }
 
         // Read final IEND chunk
@@ -1714,10 +2092,6 @@ rpng_chunk *rpng_chunk_read_all_from_memory(const char *buffer, int *count)
         memcpy(chunks[counter].data, buffer_ptr + 8, chunk_size);
         chunks[counter].crc = swap_endian(((unsigned int *)(buffer_ptr + 8 + chunk_size))[0]);
         counter++;
-
-        // Reallocate chunks file_size
-        rpng_chunk *chunks_resized = (rpng_chunk*)RPNG_REALLOC(chunks, counter*sizeof(rpng_chunk));
-        if (chunks_resized != NULL) chunks = chunks_resized;
     }
 
     *count = counter;
@@ -1734,7 +2108,8 @@ char *rpng_chunk_remove_from_memory(const char *buffer, const char *chunk_type,
 
     if ((buffer_ptr != NULL) && (memcmp(buffer_ptr, png_signature, 8) == 0))  // Check valid PNG file
     {
-        output_buffer = (char *)RPNG_CALLOC(RPNG_MAX_OUTPUT_SIZE, 1);  // Output buffer allocation
+        // NOTE: Output can not be bigger than input, it's resized at the end
+        output_buffer = (char *)RPNG_MALLOC(get_buffer_size(buffer));  // Output buffer allocation
 
         memcpy(output_buffer, png_signature, 8);        // Copy PNG signature
         output_buffer_size += 8;
@@ -1781,7 +2156,8 @@ char *rpng_chunk_remove_ancillary_from_memory(const char *buffer, int *output_si
     {
         bool preserve_palette_transparency = false;
 
-        output_buffer = (char *)RPNG_CALLOC(RPNG_MAX_OUTPUT_SIZE, 1);  // Output buffer allocation
+        // NOTE: Output can not be bigger than input, it's resized at the end
+        output_buffer = (char *)RPNG_MALLOC(get_buffer_size(buffer));  // Output buffer allocation
 
         memcpy(output_buffer, png_signature, 8);        // Copy PNG signature
         output_buffer_size += 8;
@@ -1830,7 +2206,8 @@ char *rpng_chunk_write_from_memory(const char *buffer, rpng_chunk chunk, int *ou
 
     if ((buffer_ptr != NULL) && (memcmp(buffer_ptr, png_signature, 8) == 0))  // Check valid PNG file
     {
-        output_buffer = (char *)RPNG_CALLOC(RPNG_MAX_OUTPUT_SIZE, 1);
+        // NOTE: Output size is input plus new chunk (in case IHDR is found)
+        output_buffer = (char *)RPNG_MALLOC(get_buffer_size(buffer) + 4 + 4 + chunk.length + 4);
 
         memcpy(output_buffer, png_signature, 8);        // Copy PNG signature
         output_buffer_size += 8;
@@ -1851,15 +2228,10 @@ char *rpng_chunk_write_from_memory(const char *buffer, rpng_chunk chunk, int *ou
                 memcpy(output_buffer + output_buffer_size + 4, chunk.type, 4);                // Write chunk type
                 memcpy(output_buffer + output_buffer_size + 4 + 4, chunk.data, chunk.length); // Write chunk data
 
-                unsigned char *type_data = (unsigned char *)RPNG_MALLOC(4 + chunk.length);
-                memcpy(type_data, chunk.type, 4);
-                memcpy(type_data + 4, chunk.data, chunk.length);
-                unsigned int crc = compute_crc32(type_data, 4 + chunk.length);
+                unsigned int crc = compute_crc32((unsigned char *)output_buffer + output_buffer_size + 4, 4 + chunk.length);
                 crc = swap_endian(crc);
                 memcpy(output_buffer + output_buffer_size + 4 + 4 + chunk.length, &crc, 4);   // Write CRC32 (computed over type + data)
 
-                RPNG_FREE(type_data);
-
                 output_buffer_size += (4 + 4 + chunk.length + 4);  // Update output file file_size with new chunk
             }
 
@@ -1880,49 +2252,199 @@ char *rpng_chunk_write_from_memory(const char *buffer, rpng_chunk chunk, int *ou
     return output_buffer;
 }
 
-// Combine multiple IDAT chunks into a single one
-// NOTE: Returns buffer with all concatenated IDAT chunks
-char *rpng_chunk_combine_image_data_from_memory(char *buffer, int *output_size)
+// Generate tEXt chunk
+// NOTE: Returned chunk.data must be freed by user, CRC is left to 0 (computed on writing)
+rpng_chunk rpng_chunk_gen_text(const char *keyword, const char *text)
 {
-    char *buffer_ptr = (char *)buffer;
-    char *output_buffer = NULL;
-    int output_buffer_size = 0;
-
-    if ((buffer_ptr != NULL) && (memcmp(buffer_ptr, png_signature, 8) == 0)) // Check valid PNG file
-    {
-        char *idata_buffer = (char *)RPNG_CALLOC(RPNG_MAX_OUTPUT_SIZE, 1); // Output buffer allocation
-        memcpy(idata_buffer, "IDAT", 4);
-        int idata_buffer_size = 0;
-        output_buffer = (char *)RPNG_CALLOC(RPNG_MAX_OUTPUT_SIZE, 1); // Output buffer allocation
+    rpng_chunk chunk = { 0 };
 
-        memcpy(output_buffer, png_signature, 8); // Copy PNG signature
-        output_buffer_size += 8;
-        buffer_ptr += 8; // Move pointer after signature
+    int keyword_len = (int)strlen(keyword);
+    int text_len = (int)strlen(text);
 
-        unsigned int chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+    // Fill chunk with required data
+    memcpy(chunk.type, "tEXt", 4);
+    chunk.length = keyword_len + 1 + text_len;
+    chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
+    memcpy(chunk.data, keyword, keyword_len);
+    memcpy(chunk.data + keyword_len + 1, text, text_len);
 
-        while (memcmp(buffer_ptr + 4, "IEND", 4) != 0)         // While IEND chunk not reached
-        {
-            // If IDAT chunk just copy data into idata_buffer
-            if ((memcmp(buffer_ptr + 4, "IDAT", 4) == 0))
-            {
-                memcpy(idata_buffer + 4 + idata_buffer_size, buffer_ptr + 8, chunk_size);
-                idata_buffer_size += chunk_size;
-            }
-            else
-            {
-                memcpy(output_buffer + output_buffer_size, buffer_ptr, 4 + 4 + chunk_size + 4);  // Length + FOURCC + chunk_size + CRC32
-                output_buffer_size += (4 + 4 + chunk_size + 4);
-            }
+    return chunk;
+}
 
-            buffer_ptr += (4 + 4 + chunk_size + 4);   // Move pointer to next chunk
-            chunk_size = swap_endian(((int *)buffer_ptr)[0]);
-        }
+// Generate tIME chunk
+// NOTE: Returned chunk.data must be freed by user, CRC is left to 0 (computed on writing)
+rpng_chunk rpng_chunk_gen_time(short year, char month, char day, char hour, char min, char sec)
+{
+    rpng_chunk chunk = { 0 };
 
-        // Write IDAT combined chunk
-        unsigned int idata_buffer_size_be = swap_endian(idata_buffer_size);
-        memcpy(output_buffer + output_buffer_size, &idata_buffer_size_be, 4);
-        memcpy(output_buffer + output_buffer_size + 4, idata_buffer, 4 + idata_buffer_size);
+    // Fill chunk with required data
+    memcpy(chunk.type, "tIME", 4);
+    chunk.length = 7;
+    chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
+    chunk.data[0] = (char)((year >> 8) & 0xff);     // Year stored as big endian
+    chunk.data[1] = (char)(year & 0xff);
+    memcpy(chunk.data + 2, &month, 1);
+    memcpy(chunk.data + 3, &day, 1);
+    memcpy(chunk.data + 4, &hour, 1);
+    memcpy(chunk.data + 5, &min, 1);
+    memcpy(chunk.data + 6, &sec, 1);
+
+    return chunk;
+}
+
+// Generate pHYs chunk
+// NOTE: Returned chunk.data must be freed by user, CRC is left to 0 (computed on writing)
+rpng_chunk rpng_chunk_gen_physical_size(int pixels_unit_x, int pixels_unit_y, bool meters)
+{
+    rpng_chunk chunk = { 0 };
+
+    // Fill chunk with required data
+    memcpy(chunk.type, "pHYs", 4);
+    chunk.length = 9;
+    chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
+    pixels_unit_x = swap_endian(pixels_unit_x);
+    memcpy(chunk.data, &pixels_unit_x, 4);
+    pixels_unit_y = swap_endian(pixels_unit_y);
+    memcpy(chunk.data + 4, &pixels_unit_y, 4);
+    chunk.data[8] = (meters)? 1 : 0;
+
+    return chunk;
+}
+
+// Generate zTXt chunk, DEFLATE compressed text
+// zTXt chunk information and size:
+//    unsigned char *keyword;           // Keyword: 1-80 bytes (must end with NULL separator: /0)
+//    unsigned char comp;               // Compression method (0 for DEFLATE)
+//    unsigned char *comp_text;         // Compressed text: n bytes
+// NOTE: Returned chunk.data must be freed by user, CRC is left to 0 (computed on writing)
+rpng_chunk rpng_chunk_gen_comp_text(const char *keyword, const char *text)
+{
+    rpng_chunk chunk = { 0 };
+
+    int keyword_len = (int)strlen(keyword);
+    int text_len = (int)strlen(text);
+
+    // Compress text and generate a valid zlib stream
+    struct sdefl *sde = (struct sdefl *)RPNG_CALLOC(sizeof(struct sdefl), 1);
+    int bounds = sdefl_bound(text_len);
+    unsigned char *comp_text = (unsigned char *)RPNG_CALLOC(bounds, 1);
+    int comp_text_size = zsdeflate(sde, comp_text, (const unsigned char *)text, text_len, rpng_compression_level);
+    RPNG_FREE(sde);
+
+    // Fill chunk with required data
+    memcpy(chunk.type, "zTXt", 4);
+    chunk.length = keyword_len + 1 + 1 + comp_text_size;
+    chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
+    memcpy(chunk.data, keyword, keyword_len);
+    memcpy(chunk.data + keyword_len + 2, comp_text, comp_text_size);
+
+    RPNG_FREE(comp_text);
+
+    return chunk;
+}
+
+// Read zTXt chunk text for keyword, DEFLATE decompressed
+// NOTE: Returned text is NULL terminated and must be freed by user, NULL if not found
+char *rpng_chunk_read_comp_text_from_memory(const char *buffer, const char *keyword)
+{
+    char *text = NULL;
+
+    if ((buffer == NULL) || (memcmp(buffer, png_signature, 8) != 0)) return text;   // Check valid PNG file
+
+    const unsigned char *buffer_ptr = (const unsigned char *)buffer + 8;   // Move pointer after signature
+    int keyword_len = (int)strlen(keyword);
+
+    while (memcmp(buffer_ptr + 4, "IEND", 4) != 0) // While IEND chunk not reached
+    {
+        unsigned int chunk_size = 0;
+        memcpy(&chunk_size, buffer_ptr, 4);
+        chunk_size = swap_endian(chunk_size);
+
+        // zTXt chunk data: keyword, NULL separator, compression method, compressed text
+        if ((memcmp(buffer_ptr + 4, "zTXt", 4) == 0) && ((int)chunk_size > (keyword_len + 2)) &&
+            (memcmp(buffer_ptr + 8, keyword, keyword_len + 1) == 0))
+        {
+            const unsigned char *comp_text = buffer_ptr + 8 + keyword_len + 2;
+            int comp_text_size = chunk_size - keyword_len - 2;
+
+            // Decompressed text size is unknown, output buffer sized for DEFLATE max ratio (1032:1),
+            // not zeroed (pages not written are not touched) and resized to text size after decompression
+            // WARNING: External inflate (not rpng internal copy) does not check output capacity on matches copy
+            if (comp_text_size <= (RPNG_MAX_OUTPUT_SIZE/1032))
+            {
+                int capacity = comp_text_size*1032;
+                text = (char *)RPNG_MALLOC(capacity + 1);
+                int text_size = (text != NULL)? zsinflate(text, capacity, comp_text, comp_text_size) : -1;
+
+                if (text_size < 0)
+                {
+                    RPNG_FREE(text);
+                    text = NULL;
+                }
+                else
+                {
+                    text[text_size] = '\0';   // NOTE: Inflate could write some bytes after text end
+
+                    char *text_sized = (char *)RPNG_REALLOC(text, text_size + 1);
+                    if (text_sized != NULL) text = text_sized;
+                }
+            }
+
+            if (text == NULL) RPNG_LOG("WARNING: zTXt chunk text decompression failed\n");
+            break;
+        }
+
+        buffer_ptr += (4 + 4 + chunk_size + 4); // Move pointer to next chunk of input data
+    }
+
+    return text;
+}
+
+// Combine multiple IDAT chunks into a single one
+// NOTE: Returns buffer with all concatenated IDAT chunks
+char *rpng_chunk_combine_image_data_from_memory(char *buffer, int *output_size)
+{
+    char *buffer_ptr = (char *)buffer;
+    char *output_buffer = NULL;
+    int output_buffer_size = 0;
+
+    if ((buffer_ptr != NULL) && (memcmp(buffer_ptr, png_signature, 8) == 0)) // Check valid PNG file
+    {
+        // NOTE: Combined IDAT data and output can not be bigger than input, output is resized at the end
+        int input_size = get_buffer_size(buffer);
+        char *idata_buffer = (char *)RPNG_MALLOC(input_size); // Output buffer allocation
+        memcpy(idata_buffer, "IDAT", 4);
+        int idata_buffer_size = 0;
+        output_buffer = (char *)RPNG_MALLOC(input_size); // Output buffer allocation
+
+        memcpy(output_buffer, png_signature, 8); // Copy PNG signature
+        output_buffer_size += 8;
+        buffer_ptr += 8; // Move pointer after signature
+
+        unsigned int chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+
+        while (memcmp(buffer_ptr + 4, "IEND", 4) != 0)         // While IEND chunk not reached
+        {
+            // If IDAT chunk just copy data into idata_buffer
+            if ((memcmp(buffer_ptr + 4, "IDAT", 4) == 0))
+            {
+                memcpy(idata_buffer + 4 + idata_buffer_size, buffer_ptr + 8, chunk_size);
+                idata_buffer_size += chunk_size;
+            }
+            else
+            {
+                memcpy(output_buffer + output_buffer_size, buffer_ptr, 4 + 4 + chunk_size + 4);  // Length + FOURCC + chunk_size + CRC32
+                output_buffer_size += (4 + 4 + chunk_size + 4);
+            }
+
+            buffer_ptr += (4 + 4 + chunk_size + 4);   // Move pointer to next chunk
+            chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+        }
+
+        // Write IDAT combined chunk
+        unsigned int idata_buffer_size_be = swap_endian(idata_buffer_size);
+        memcpy(output_buffer + output_buffer_size, &idata_buffer_size_be, 4);
+        memcpy(output_buffer + output_buffer_size + 4, idata_buffer, 4 + idata_buffer_size);
         unsigned int crc = compute_crc32((unsigned char *)idata_buffer, 4 + idata_buffer_size);
         crc = swap_endian(crc);
         memcpy(output_buffer + output_buffer_size + 4 + 4 + idata_buffer_size, &crc, 4);
@@ -1954,7 +2476,9 @@ char *rpng_chunk_split_image_data_from_memory(char *buffer, int split_size, int
     {
         char *idata_split_buffer = (char *)RPNG_CALLOC(split_size + 12, 1);    // Output buffer allocation
 
-        output_buffer = (char *)RPNG_CALLOC(RPNG_MAX_OUTPUT_SIZE, 1);  // Output buffer allocation
+        // NOTE: Output size is input plus one chunk header+CRC for every split piece, it's resized at the end
+        int input_size = get_buffer_size(buffer);
+        output_buffer = (char *)RPNG_MALLOC(input_size + (input_size/split_size + 1)*12);  // Output buffer allocation
 
         memcpy(output_buffer, png_signature, 8);    // Copy PNG signature
         output_buffer_size += 8;
@@ -1981,134 +2505,672 @@ char *rpng_chunk_split_image_data_from_memory(char *buffer, int split_size, int
                     crc = swap_endian(crc);
                     memcpy(idata_split_buffer + 4 + 4 + split_size, &crc, 4);
 
-                    chunk_remain_size -= split_size;
-                    buffer_ptr_offset += split_size;
+                    chunk_remain_size -= split_size;
+                    buffer_ptr_offset += split_size;
+
+                    memcpy(output_buffer + output_buffer_size, idata_split_buffer, split_size + 12);
+                    output_buffer_size += (split_size + 12);
+                }
+
+                // Save last IDAT chunk piece
+                unsigned int chunk_remain_size_be = swap_endian(chunk_remain_size);
+                memcpy(idata_split_buffer, &chunk_remain_size_be, 4);
+                memcpy(idata_split_buffer + 4, "IDAT", 4);
+                memcpy(idata_split_buffer + 4 + 4, buffer_ptr_offset, chunk_remain_size);
+                unsigned int crc = compute_crc32((unsigned char *)(idata_split_buffer + 4), 4 + chunk_remain_size);
+                crc = swap_endian(crc);
+                memcpy(idata_split_buffer + 4 + 4 + chunk_remain_size, &crc, 4);
+
+                memcpy(output_buffer + output_buffer_size, idata_split_buffer, chunk_remain_size + 12);
+                output_buffer_size += (chunk_remain_size + 12);
+            }
+            else
+            {
+                memcpy(output_buffer + output_buffer_size, buffer_ptr, 4 + 4 + chunk_size + 4);  // Length + FOURCC + chunk_size + CRC32
+                output_buffer_size += (4 + 4 + chunk_size + 4);
+            }
+
+            buffer_ptr += (4 + 4 + chunk_size + 4);   // Move pointer to next chunk
+            chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+        }
+
+        RPNG_FREE(idata_split_buffer);
+
+        // Write IEND chunk
+        memcpy(output_buffer + output_buffer_size, buffer_ptr, 4 + 4 + 4);
+        output_buffer_size += 12;
+
+        // Resize output buffer
+        char *output_buffer_sized = (char *)RPNG_REALLOC(output_buffer, output_buffer_size);
+        if (output_buffer_sized != NULL) output_buffer = output_buffer_sized;
+    }
+
+    *output_size = output_buffer_size;
+    return output_buffer;
+}
+
+// Open chunks editing session from PNG file
+// NOTE: File is loaded once, session must be closed with rpng_session_close()
+rpng_session rpng_session_open(const char *filename)
+{
+    rpng_session session = { 0 };
+
+    int file_size = 0;
+    char *file_data = load_file_to_buffer(filename, &file_size);
+
+    if (file_data != NULL)
+    {
+        session = rpng_session_open_from_memory(file_data);
+        session.buffer_owned = true;
+
+        if (session.count == 0) rpng_session_close(&session);
+    }
+
+    return session;
+}
+
+// Open chunks editing session from PNG memory buffer
+// NOTE: Buffer is not copied, session chunks point to it until session is closed
+rpng_session rpng_session_open_from_memory(const char *buffer)
+{
+    rpng_session session = { 0 };
+    char *buffer_ptr = (char *)buffer;
+
+    if ((buffer_ptr != NULL) && (memcmp(buffer_ptr, png_signature, 8) == 0))  // Check valid PNG file signature
+    {
+        session.buffer = buffer_ptr;
+        session.capacity = rpng_chunk_count_from_memory(buffer) + 8;    // Some extra space for added chunks
+        session.chunks = (rpng_chunk *)RPNG_CALLOC(session.capacity, sizeof(rpng_chunk));
+        session.chunks_owned = (bool *)RPNG_CALLOC(session.capacity, sizeof(bool));
+
+        buffer_ptr += 8;    // Move pointer after signature
+        unsigned int chunk_size = 0;
+
+        while (true)
+        {
+            rpng_chunk *chunk = &session.chunks[session.count];
+
+            memcpy(&chunk_size, buffer_ptr, 4);
+            chunk->length = swap_endian(chunk_size);
+            memcpy(chunk->type, buffer_ptr + 4, 4);
+            chunk->data = buffer_ptr + 8;
+            memcpy(&chunk->crc, buffer_ptr + 8 + chunk->length, 4);
+            chunk->crc = swap_endian(chunk->crc);
+            session.count++;
+
+            if (memcmp(chunk->type, "IHDR", 4) == 0) session.insert_position = session.count;
+            if (memcmp(chunk->type, "IEND", 4) == 0) break;
+
+            buffer_ptr += (4 + 4 + chunk->length + 4);   // Move pointer to next chunk
+        }
+    }
+
+    return session;
+}
+
+// Add one new chunk (any kind)
+// NOTE: Chunk is added after IHDR (and previously added chunks), data is copied
+void rpng_session_add_chunk(rpng_session *session, rpng_chunk chunk)
+{
+    if (session->count > 0)
+    {
+        rpng_session_insert(session, session->insert_position, chunk);
+        session->insert_position++;
+    }
+}
+
+// Replace chunk type, first chunk found is replaced (in place) and others of same type removed
+// NOTE: Chunk is added if no chunk of same type is found, data is copied
+void rpng_session_replace_chunk(rpng_session *session, rpng_chunk chunk)
+{
+    int position = -1;
+
+    for (int i = 0; i < session->count; i++)
+    {
+        if (memcmp(session->chunks[i].type, chunk.type, 4) == 0)
+        {
+            position = i;
+            break;
+        }
+    }
+
+    if (position >= 0)
+    {
+        rpng_session_remove_chunk(session, chunk.type);
+        if (position > session->count - 1) position = session->count - 1;   // Keep IEND as last chunk
+        rpng_session_insert(session, position, chunk);
+        if (position < session->insert_position) session->insert_position++;
+    }
+    else rpng_session_add_chunk(session, chunk);
+}
+
+// Remove one chunk type, all chunks of that type are removed
+void rpng_session_remove_chunk(rpng_session *session, const char *chunk_type)
+{
+    for (int i = session->count - 1; i >= 0; i--)
+    {
+        if (memcmp(session->chunks[i].type, chunk_type, 4) == 0) rpng_session_delete(session, i);
+    }
+}
+
+// Remove all chunks except: IHDR-PLTE-IDAT-IEND
+// NOTE: tRNS is also preserved in case of PLTE available (palette transparency)
+void rpng_session_remove_ancillary(rpng_session *session)
+{
+    bool preserve_palette_transparency = false;
+
+    for (int i = 0; i < session->count; i++)
+    {
+        if (memcmp(session->chunks[i].type, "PLTE", 4) == 0) preserve_palette_transparency = true;
+    }
+
+    for (int i = session->count - 1; i >= 0; i--)
+    {
+        const char *type = session->chunks[i].type;
+
+        if ((memcmp(type, "IHDR", 4) != 0) && (memcmp(type, "PLTE", 4) != 0) &&
+            (memcmp(type, "IDAT", 4) != 0) && (memcmp(type, "IEND", 4) != 0) &&
+            !(preserve_palette_transparency && (memcmp(type, "tRNS", 4) == 0))) rpng_session_delete(session, i);
+    }
+}
+
+// Write session chunks to PNG file
+// NOTE: Session is not closed, filename could be the same file session was opened from
+int rpng_session_commit(rpng_session *session, const char *filename)
+{
+    int result = RPNG_ERROR_MEMORY_ALLOC;
+
+    int file_output_size = 0;
+    char *file_output = rpng_session_commit_to_memory(session, &file_output_size);
+
+    if (file_output != NULL) result = save_file_from_buffer(filename, file_output, file_output_size);
+    else RPNG_LOG("WARNING: Failed to save file, session not valid\n");
+
+    RPNG_FREE(file_output);
+
+    return result;
+}
+
+// Write session chunks to memory buffer
+// NOTE: Output buffer is allocated once, chunks CRC only computed for chunks added/replaced
+char *rpng_session_commit_to_memory(rpng_session *session, int *output_size)
+{
+    char *output_buffer = NULL;
+    int output_buffer_size = 0;
+
+    if (session->count > 0)
+    {
+        output_buffer_size = 8;
+        for (int i = 0; i < session->count; i++) output_buffer_size += (4 + 4 + session->chunks[i].length + 4);
+
+        output_buffer = (char *)RPNG_MALLOC(output_buffer_size);
+        memcpy(output_buffer, png_signature, 8);        // Copy PNG signature
+        char *output_ptr = output_buffer + 8;
+
+        for (int i = 0; i < session->count; i++)
+        {
+            rpng_chunk *chunk = &session->chunks[i];
+
+            if (session->chunks_owned[i])
+            {
+                unsigned int length = swap_endian(chunk->length);
+                memcpy(output_ptr, &length, 4);
+                memcpy(output_ptr + 4, chunk->type, 4);
+                if (chunk->length > 0) memcpy(output_ptr + 8, chunk->data, chunk->length);
+                unsigned int crc = swap_endian(compute_crc32_chunk(chunk->type, chunk->data, chunk->length));
+                memcpy(output_ptr + 8 + chunk->length, &crc, 4);
+            }
+            else memcpy(output_ptr, chunk->data - 8, 4 + 4 + chunk->length + 4);   // Length + FOURCC + chunk data + CRC32 (from buffer)
+
+            output_ptr += (4 + 4 + chunk->length + 4);
+        }
+    }
+
+    *output_size = output_buffer_size;
+    return output_buffer;
+}
+
+// Close chunks editing session, free memory
+// NOTE: Memory buffer provided on session opening is not freed
+void rpng_session_close(rpng_session *session)
+{
+    for (int i = 0; i < session->count; i++)
+    {
+        if (session->chunks_owned[i]) RPNG_FREE(session->chunks[i].data);
+    }
+
+    RPNG_FREE(session->chunks);
+    RPNG_FREE(session->chunks_owned);
+    if (session->buffer_owned) RPNG_FREE(session->buffer);
+
+    rpng_session empty = { 0 };
+    *session = empty;
+}
+
+// Get memory currently allocated by the library
+int rpng_memory_get_current(void)
+{
+#if defined(RPNG_MEMORY_STATS)
+    return (int)rpng_memory_current;
+#else
+    return 0;
+#endif
+}
+
+// Get peak memory allocated by the library
+int rpng_memory_get_peak(void)
+{
+#if defined(RPNG_MEMORY_STATS)
+    return (int)rpng_memory_peak;
+#else
+    return 0;
+#endif
+}
+
+// Reset peak memory to current allocated memory
+void rpng_memory_reset_peak(void)
+{
+#if defined(RPNG_MEMORY_STATS)
+    rpng_memory_peak = rpng_memory_current;
+#endif
+}
+
+#if defined(RPNG_MEMORY_STATS)
+// Memory allocations are tracked with a small header before returned pointer, storing allocation size
+// NOTE: Header keeps 16 bytes alignment, required by SSE2 loads/stores
+#define RPNG_MEMORY_HEADER_SIZE     16
+
+// Register allocated/freed memory, updating peak
+// NOTE: Atomic operations used if available, memory can be allocated from multiple threads
+static void rpng_memory_track(long long size)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    long long current = __atomic_add_fetch(&rpng_memory_current, size, __ATOMIC_RELAXED);
+    long long peak = __atomic_load_n(&rpng_memory_peak, __ATOMIC_RELAXED);
+    while ((current > peak) && !__atomic_compare_exchange_n(&rpng_memory_peak, &peak, current, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) { }
+#else
+    rpng_memory_current += size;
+    if (rpng_memory_current > rpng_memory_peak) rpng_memory_peak = rpng_memory_current;
+#endif
+}
+
+// Allocate memory, tracked
+void *rpng_memory_alloc(int size, int zero)
+{
+    if (size < 0) return NULL;
+
+    char *ptr = (char *)(zero? calloc(RPNG_MEMORY_HEADER_SIZE + size, 1) : malloc(RPNG_MEMORY_HEADER_SIZE + size));
+    if (ptr == NULL) return NULL;
+
+    *(long long *)ptr = size;
+    rpng_memory_track(size);
+
+    return ptr + RPNG_MEMORY_HEADER_SIZE;
+}
+
+// Reallocate memory, tracked
+void *rpng_memory_realloc(void *ptr, int size)
+{
+    if (ptr == NULL) return rpng_memory_alloc(size, 0);
+    if (size < 0) return NULL;
+
+    char *base = (char *)ptr - RPNG_MEMORY_HEADER_SIZE;
+    long long prev_size = *(long long *)base;
+
+    // NOTE: Growing memory is registered before realloc(), peak includes both buffers (data could be moved)
+    if (size > prev_size) rpng_memory_track(size);
+
+    char *base_resized = (char *)realloc(base, RPNG_MEMORY_HEADER_SIZE + size);
+
+    if (base_resized == NULL)
+    {
+        if (size > prev_size) rpng_memory_track(-size);
+        return NULL;
+    }
+
+    *(long long *)base_resized = size;
+    if (size > prev_size) rpng_memory_track(-prev_size);
+    else rpng_memory_track(size - prev_size);
+
+    return base_resized + RPNG_MEMORY_HEADER_SIZE;
+}
+
+// Free memory, tracked
+void rpng_memory_free(void *ptr)
+{
+    if (ptr == NULL) return;
+
+    char *base = (char *)ptr - RPNG_MEMORY_HEADER_SIZE;
+    rpng_memory_track(-*(long long *)base);
+
+    free(base);
+}
+#endif  // RPNG_MEMORY_STATS
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Prefilter and compress image data
+// NOTE: forced_filter_type -1 uses the filter type set with rpng_set_filter_type()
+static char *rpng_deflate_image_data(const char *image_data, int image_data_size, int width, int height, int pixel_size, int *output_size, unsigned int *crc, int forced_filter_type)
+{
+    char *idat_data = NULL;
+
+    // Image data pre-processing to append filter type byte to every scanline
+    //int pixel_size = color_channels*(bit_depth/8);
+    int scanline_size = width*pixel_size;
+    unsigned int data_filtered_size = (scanline_size + 1)*height;   // Adding 1 byte per scanline filter
+    unsigned char *data_filtered = (unsigned char *)RPNG_CALLOC(data_filtered_size, 1);
+
+    int filter_type = (forced_filter_type == -1)? rpng_filter_type : forced_filter_type;
+    if ((filter_type < RPNG_FILTER_ADAPTIVE) || (filter_type > RPNG_FILTER_PAETH)) filter_type = RPNG_FILTER_ADAPTIVE;
+
+    // Scanlines are processed from zero padded copies (current and previous), filtered by all required
+    // filters in one pass into one buffer per filter, best filter scanline is copied into output
+    int stride = (scanline_size + 15) & ~15;
+    unsigned char *scanlines = (unsigned char *)RPNG_CALLOC(2*(RPNG_SCANLINE_PADDING + stride) + 5*stride, 1);
+    unsigned char *cur = scanlines + RPNG_SCANLINE_PADDING;
+    unsigned char *prev = cur + stride + RPNG_SCANLINE_PADDING;     // First scanline previous is zeroed
+    unsigned char *filtered = prev + stride;
+
+    for (int y = 0; y < height; y++)
+    {
+        unsigned int sums[5] = { 0 };
+        int best_filter = filter_type;
+
+        memcpy(cur, (const unsigned char *)image_data + scanline_size*y, scanline_size);
+
+        rpng_filter_scanline(cur, prev, scanline_size, pixel_size, filter_type, filtered, stride, sums);
+
+        if (filter_type == RPNG_FILTER_ADAPTIVE)
+        {
+            // Select the filter that gives the smallest sum of absolute values of outputs
+            // NOTE: Considering the output bytes as signed differences for the test
+            // REF: https://www.w3.org/TR/PNG-Encoders.html#E.Filter-selection
+            best_filter = 0;
+            for (int filter = 1; filter < 5; filter++) if (sums[filter] < sums[best_filter]) best_filter = filter;
+        }
+
+        // Register scanline filter byte and best filter scanline
+        data_filtered[(scanline_size + 1)*y] = (unsigned char)best_filter;
+        memcpy(data_filtered + (scanline_size + 1)*y + 1, filtered + best_filter*stride, scanline_size);
+
+        // Current scanline becomes previous one
+        unsigned char *temp = prev;
+        prev = cur;
+        cur = temp;
+    }
+
+    RPNG_FREE(scanlines);
+
+    // Compress filtered image data and generate a valid zlib stream
+    char *comp_data = NULL;
+    int comp_data_size = 0;
+
+#if defined(RPNG_THREADS)
+    // Scanlines ranges compressed by multiple threads, only for big enough image data
+    int job_count = (int)(data_filtered_size/RPNG_THREADS_MIN_DATA);
+    if (job_count > rpng_thread_count) job_count = rpng_thread_count;
+    if (job_count > height) job_count = height;
+
+    if (job_count > 1) comp_data = rpng_deflate_data_threaded(data_filtered, data_filtered_size, scanline_size + 1, job_count, &comp_data_size, crc);
+#endif
+
+    if (comp_data == NULL)
+    {
+        struct sdefl *sde = (struct sdefl*)RPNG_CALLOC(sizeof(struct sdefl), 1);
+        int bounds = sdefl_bound(data_filtered_size);
+        comp_data = (char *)RPNG_CALLOC(bounds, 1);
+        comp_data_size = zsdeflate(sde, comp_data, data_filtered, data_filtered_size, rpng_compression_level);
+        RPNG_FREE(sde);
+
+        if (comp_data_size > 0) *crc = compute_crc32_chunk("IDAT", comp_data, comp_data_size);
+    }
+
+    RPNG_FREE(data_filtered);
+
+    if ((comp_data != NULL) && (comp_data_size > 0))
+    {
+        idat_data = comp_data;
+        *output_size = comp_data_size;
+        RPNG_LOG("INFO: Image data deflated successfully: %i bytes -> %i bytes\n", data_filtered_size, comp_data_size);
+    }
+    else RPNG_LOG("INFO: Image data deflating failed\n");
+
+    return idat_data;
+}
+
+#if defined(RPNG_THREADS)
+// Compress data using multiple threads, data split in ranges aligned to rows (scanlines)
+// NOTE: Every range is a raw deflate stream using previous 32KB of data as dictionary (same compression
+// ratio than one stream), not last ranges end with a sync flush (range last byte as stored block, byte
+// aligned, not final), so ranges are just joined, zlib header prepended and Adler-32 combined,
+// IDAT chunk CRC32 is also combined from ranges compressed data CRC32 (computed by threads)
+// REF: https://www.rfc-editor.org/rfc/rfc1951#page-11 (non-compressed blocks)
+static char *rpng_deflate_data_threaded(const unsigned char *data, int data_size, int row_size, int job_count, int *output_size, unsigned int *crc)
+{
+    char *comp_data = NULL;
+    rpng_deflate_job jobs[RPNG_MAX_THREADS] = { 0 };
+    pthread_t threads[RPNG_MAX_THREADS] = { 0 };
+    bool threads_created[RPNG_MAX_THREADS] = { 0 };
+
+    int row_count = data_size/row_size;
+
+    for (int i = 0; i < job_count; i++)
+    {
+        jobs[i].data = data;
+        jobs[i].begin = (int)(((long long)row_count*i/job_count)*row_size);
+        jobs[i].end = (int)(((long long)row_count*(i + 1)/job_count)*row_size);
+        jobs[i].last = (i == (job_count - 1));
+    }
+
+    // Calling thread compresses first range, other ranges compressed by new threads
+    // NOTE: In case a thread can not be created, its range is compressed by calling thread
+    for (int i = 1; i < job_count; i++) threads_created[i] = (pthread_create(&threads[i], NULL, rpng_deflate_job_process, &jobs[i]) == 0);
+
+    rpng_deflate_job_process(&jobs[0]);
+
+    for (int i = 1; i < job_count; i++)
+    {
+        if (threads_created[i]) pthread_join(threads[i], NULL);
+        else rpng_deflate_job_process(&jobs[i]);
+    }
+
+    // Join ranges compressed data: zlib header + ranges data + Adler-32 (big endian)
+    int comp_data_size = 2 + 4;
+    bool success = true;
+
+    for (int i = 0; i < job_count; i++)
+    {
+        if (jobs[i].output == NULL) success = false;
+        comp_data_size += jobs[i].output_size;
+    }
+
+    if (success) comp_data = (char *)RPNG_MALLOC(comp_data_size);
 
-                    memcpy(output_buffer + output_buffer_size, idata_split_buffer, split_size + 12);
-                    output_buffer_size += (split_size + 12);
-                }
+    if (comp_data != NULL)
+    {
+        unsigned char *ptr = (unsigned char *)comp_data;
+        unsigned int adler = jobs[0].adler;
 
-                // Save last IDAT chunk piece
-                unsigned int chunk_remain_size_be = swap_endian(chunk_remain_size);
-                memcpy(idata_split_buffer, &chunk_remain_size_be, 4);
-                memcpy(idata_split_buffer + 4, "IDAT", 4);
-                memcpy(idata_split_buffer + 4 + 4, buffer_ptr_offset, chunk_remain_size);
-                unsigned int crc = compute_crc32((unsigned char *)(idata_split_buffer + 4), 4 + chunk_remain_size);
-                crc = swap_endian(crc);
-                memcpy(idata_split_buffer + 4 + 4 + chunk_remain_size, &crc, 4);
+        // NOTE: Same zlib header than zsdeflate(): deflate, 32KB window
+        *ptr++ = 0x78;
+        *ptr++ = 0x01;
 
-                memcpy(output_buffer + output_buffer_size, idata_split_buffer, chunk_remain_size + 12);
-                output_buffer_size += (chunk_remain_size + 12);
-            }
-            else
-            {
-                memcpy(output_buffer + output_buffer_size, buffer_ptr, 4 + 4 + chunk_size + 4);  // Length + FOURCC + chunk_size + CRC32
-                output_buffer_size += (4 + 4 + chunk_size + 4);
-            }
+        unsigned int crc_data = compute_crc32_chunk("IDAT", comp_data, 2);
 
-            buffer_ptr += (4 + 4 + chunk_size + 4);   // Move pointer to next chunk
-            chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+        for (int i = 0; i < job_count; i++)
+        {
+            memcpy(ptr, jobs[i].output, jobs[i].output_size);
+            ptr += jobs[i].output_size;
+
+            if (i > 0) adler = rpng_adler32_combine(adler, jobs[i].adler, jobs[i].end - jobs[i].begin);
+            crc_data = crc32_combine(crc_data, jobs[i].crc, jobs[i].output_size);
         }
 
-        RPNG_FREE(idata_split_buffer);
+        adler = swap_endian(adler);
+        memcpy(ptr, &adler, 4);
+        *crc = ~update_crc32(~crc_data, ptr, 4);
 
-        // Write IEND chunk
-        memcpy(output_buffer + output_buffer_size, buffer_ptr, 4 + 4 + 4);
-        output_buffer_size += 12;
+        *output_size = comp_data_size;
+        RPNG_LOG("INFO: Image data compressed by %i threads\n", job_count);
+    }
 
-        // Resize output buffer
-        char *output_buffer_sized = (char *)RPNG_REALLOC(output_buffer, output_buffer_size);
-        if (output_buffer_sized != NULL) output_buffer = output_buffer_sized;
+    for (int i = 0; i < job_count; i++) RPNG_FREE(jobs[i].output);
+
+    return comp_data;
+}
+
+// Compress data range (thread function)
+static void *rpng_deflate_job_process(void *data)
+{
+    rpng_deflate_job *job = (rpng_deflate_job *)data;
+    struct sdefl *sde = (struct sdefl *)RPNG_CALLOC(sizeof(struct sdefl), 1);
+
+    // NOTE: Sync flush requires up to 6 additional bytes (one byte stored block)
+    if (sde != NULL) job->output = (unsigned char *)RPNG_MALLOC(sdefl_bound(job->end - job->begin) + 6);
+
+    if (job->output != NULL)
+    {
+        job->output_size = sdefl_compr(sde, job->output, job->data, job->begin, job->end, rpng_compression_level, job->last);
+        job->adler = sdefl_adler32(1, job->data + job->begin, job->end - job->begin);
+        job->crc = compute_crc32(job->output, job->output_size);
     }
 
-    *output_size = output_buffer_size;
-    return output_buffer;
+    RPNG_FREE(sde);
+
+    return NULL;
 }
 
-//----------------------------------------------------------------------------------
-// Module Internal Functions Definition
-//----------------------------------------------------------------------------------
+// Combine Adler-32 checksums of two consecutive data blocks, second block size required
+// REF: zlib adler32_combine()
+static unsigned int rpng_adler32_combine(unsigned int adler1, unsigned int adler2, int size2)
+{
+    const unsigned int base = 65521;     // Largest prime smaller than 65536
 
-// Prefilter and compress image data
-static char *rpng_deflate_image_data(const char *image_data, int image_data_size, int width, int height, int pixel_size, int *output_size, int forced_filter_type)
+    unsigned int rem = (unsigned int)(size2%base);
+    unsigned int sum1 = adler1 & 0xffff;
+    unsigned int sum2 = (unsigned int)(((unsigned long long)rem*sum1)%base);
+
+    sum1 += (adler2 & 0xffff) + base - 1;
+    sum2 += ((adler1 >> 16) & 0xffff) + ((adler2 >> 16) & 0xffff) + base - rem;
+
+    if (sum1 >= base) sum1 -= base;
+    if (sum1 >= base) sum1 -= base;
+    if (sum2 >= (base << 1)) sum2 -= (base << 1);
+    if (sum2 >= base) sum2 -= base;
+
+    return (sum1 | (sum2 << 16));
+}
+#endif
+
+// Filter scanline with requested filter, or all filters if RPNG_FILTER_ADAPTIVE
+// NOTE: Scanlines (cur, prev) require RPNG_SCANLINE_PADDING zeroed bytes before data and zeroed bytes
+// after data up to stride, filtered scanlines are written at filtered + filter*stride and the sums of
+// absolute values of outputs (as signed differences) are returned for every filter computed
+// REF: https://www.w3.org/TR/PNG/#9Filters
+static void rpng_filter_scanline(const unsigned char *cur, const unsigned char *prev, int size, int pixel_size, int filter_type, unsigned char *filtered, int stride, unsigned int *sums)
 {
-    char *idat_data = NULL;
+    int first = (filter_type == RPNG_FILTER_ADAPTIVE)? 0 : filter_type;
+    int last = (filter_type == RPNG_FILTER_ADAPTIVE)? 4 : filter_type;
 
-    // Image data pre-processing to append filter type byte to every scanline
-    //int pixel_size = color_channels*(bit_depth/8);
-    int scanline_size = width*pixel_size;
-    unsigned int data_filtered_size = (scanline_size + 1)*height;   // Adding 1 byte per scanline filter
-    unsigned char *data_filtered = (unsigned char *)RPNG_CALLOC(data_filtered_size, 1);
+#if defined(RPNG_SIMD_SSE2)
+    // Masks to only consider scanline data bytes on last block sums
+    static const unsigned char tail_masks[32] = {
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 
-    int out = 0, x = 0, a = 0, b = 0, c = 0;
-    int sum_value[5] = { 0 };
-    int best_filter = 0;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi8(1);
+    __m128i sum[5] = { zero, zero, zero, zero, zero };
 
-    for (int y = 0; y < height; y++)
+    for (int p = 0; p < size; p += 16)
     {
-        if (forced_filter_type == -1)
+        // x = current byte
+        // a = left pixel byte (from current)
+        // b = above pixel byte (from current)
+        // c = left pixel byte (from b)
+        __m128i x = _mm_loadu_si128((const __m128i *)(cur + p));
+        __m128i a = _mm_loadu_si128((const __m128i *)(cur + p - pixel_size));
+        __m128i b = _mm_loadu_si128((const __m128i *)(prev + p));
+        __m128i c = _mm_loadu_si128((const __m128i *)(prev + p - pixel_size));
+        __m128i mask = (size - p < 16)? _mm_loadu_si128((const __m128i *)(tail_masks + 16 - (size - p))) : _mm_set1_epi8(-1);
+
+        for (int filter = first; filter <= last; filter++)
         {
-            // Choose the best filter type for every scanline
-            // REF: https://www.w3.org/TR/PNG-Encoders.html#E.Filter-selection
-            for (int p = 0; p < scanline_size; p++)
+            __m128i out = x;
+
+            switch (filter)
             {
-                // x = current byte
-                // a = left pixel byte (from current)
-                // b = above pixel byte (from current)
-                // c = left pixel byte (from b)
-                x = (int)((unsigned char *)image_data)[scanline_size*y + p];
-                a = (p >= pixel_size) ? (int)((unsigned char *)image_data)[scanline_size*y + p - pixel_size] : 0;
-                b = (y > 0) ? (int)((unsigned char *)image_data)[scanline_size*(y - 1) + p] : 0;
-                c = (y > 0) ? ((p >= pixel_size) ? (int)((unsigned char *)image_data)[scanline_size*(y - 1) + p - pixel_size] : 0) : 0;
-
-                // Heuristic: Compute the output scanline using all five filters
-                // REF: https://www.w3.org/TR/PNG/#9Filters
-                for (int filter = 0; filter < 5; filter++)
+                case 1: out = _mm_sub_epi8(x, a); break;
+                case 2: out = _mm_sub_epi8(x, b); break;
+                case 3:
                 {
-                    switch (filter)
+                    // Average rounding down: avg_epu8() rounds up, corrected with (a ^ b) & 1
+                    __m128i avg = _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), one));
+                    out = _mm_sub_epi8(x, avg);
+                } break;
+                case 4:
+                {
+                    // Paeth predictor computed exactly in 16 bit: p - a = b - c, p - b = a - c, p - c = (b - c) + (a - c)
+                    __m128i pr[2] = { 0 };
+
+                    for (int h = 0; h < 2; h++)
                     {
-                        case 0: out = x; break;
-                        case 1: out = x - a; break;
-                        case 2: out = x - b; break;
-                        case 3: out = x - ((a + b)>>1); break;
-                        case 4: out = x - rpng_paeth_predictor(a, b, c); break;
-                        default: break;
+                        __m128i a16 = h? _mm_unpackhi_epi8(a, zero) : _mm_unpacklo_epi8(a, zero);
+                        __m128i b16 = h? _mm_unpackhi_epi8(b, zero) : _mm_unpacklo_epi8(b, zero);
+                        __m128i c16 = h? _mm_unpackhi_epi8(c, zero) : _mm_unpacklo_epi8(c, zero);
+
+                        __m128i pa = _mm_sub_epi16(b16, c16);
+                        __m128i pb = _mm_sub_epi16(a16, c16);
+                        __m128i pc = _mm_add_epi16(pa, pb);
+                        pa = _mm_max_epi16(pa, _mm_sub_epi16(zero, pa));
+                        pb = _mm_max_epi16(pb, _mm_sub_epi16(zero, pb));
+                        pc = _mm_max_epi16(pc, _mm_sub_epi16(zero, pc));
+
+                        // Predictor: a if (pa <= pb) && (pa <= pc), else b if (pb <= pc), else c
+                        __m128i not_a = _mm_or_si128(_mm_cmpgt_epi16(pa, pb), _mm_cmpgt_epi16(pa, pc));
+                        __m128i use_c = _mm_cmpgt_epi16(pb, pc);
+                        __m128i bc = _mm_or_si128(_mm_and_si128(use_c, c16), _mm_andnot_si128(use_c, b16));
+                        pr[h] = _mm_or_si128(_mm_and_si128(not_a, bc), _mm_andnot_si128(not_a, a16));
                     }
 
-                    sum_value[filter] += abs((signed char)out);
-                }
+                    out = _mm_sub_epi8(x, _mm_packus_epi16(pr[0], pr[1]));
+                } break;
+                default: break;
             }
 
-            // Select the filter that gives the smallest sum of absolute values of outputs.
-            // NOTE: Considering the output bytes as signed differences for the test.
-            best_filter = 0;
-            int best_value = sum_value[0];
+            _mm_storeu_si128((__m128i *)(filtered + filter*stride + p), out);
 
-            for (int filter = 1; filter < 5; filter++)
-            {
-                if (sum_value[filter] < best_value)
-                {
-                    best_value = sum_value[filter];
-                    best_filter = filter;
-                }
-            }
+            // Absolute value of signed bytes: min(out, -out) as unsigned, summed with sad_epu8()
+            __m128i out_abs = _mm_and_si128(_mm_min_epu8(out, _mm_sub_epi8(zero, out)), mask);
+            sum[filter] = _mm_add_epi64(sum[filter], _mm_sad_epu8(out_abs, zero));
         }
-        else if ((forced_filter_type >= 0) && (forced_filter_type <= 4)) best_filter = forced_filter_type;
-
-        // Register scanline filter byte
-        data_filtered[(scanline_size + 1)*y] = best_filter;
+    }
 
-        // Apply the best_filter to scanline
-        for (int p = 0; p < scanline_size; p++)
+    for (int filter = first; filter <= last; filter++)
+    {
+        sums[filter] = (unsigned int)(_mm_cvtsi128_si32(sum[filter]) + _mm_cvtsi128_si32(_mm_srli_si128(sum[filter], 8)));
+    }
+#else
+    for (int p = 0; p < size; p++)
+    {
+        // x = current byte
+        // a = left pixel byte (from current)
+        // b = above pixel byte (from current)
+        // c = left pixel byte (from b)
+        int x = cur[p];
+        int a = cur[p - pixel_size];
+        int b = prev[p];
+        int c = prev[p - pixel_size];
+
+        for (int filter = first; filter <= last; filter++)
         {
-            x = (int)((unsigned char *)image_data)[scanline_size*y + p];
-            a = (p >= pixel_size)? (int)((unsigned char *)image_data)[scanline_size*y + p - pixel_size] : 0;
-            b = (y > 0)? (int)((unsigned char *)image_data)[scanline_size*(y - 1) + p] : 0;
-            c = (y > 0)? ((p >= pixel_size) ? (int)((unsigned char *)image_data)[scanline_size*(y - 1) + p - pixel_size] : 0) : 0;
+            int out = x;
 
-            switch (best_filter)
+            switch (filter)
             {
-                case 0: out = x; break;
                 case 1: out = x - a; break;
                 case 2: out = x - b; break;
                 case 3: out = x - ((a + b)>>1); break;
@@ -2116,38 +3178,29 @@ static char *rpng_deflate_image_data(const char *image_data, int image_data_size
                 default: break;
             }
 
-            // Register scanline filtered values, byte by byte
-            data_filtered[(scanline_size + 1)*y + 1 + p] = (unsigned char)out;
+            filtered[filter*stride + p] = (unsigned char)out;
+            sums[filter] += abs((signed char)out);
         }
     }
-
-    // Compress filtered image data and generate a valid zlib stream
-    struct sdefl *sde = (struct sdefl*)RPNG_CALLOC(sizeof(struct sdefl), 1);
-    int bounds = sdefl_bound(data_filtered_size);
-    char *comp_data = (char *)RPNG_CALLOC(bounds, 1);
-    int comp_data_size = zsdeflate(sde, comp_data, data_filtered, data_filtered_size, RPNG_COMPRESSION_LEVEL);
-    RPNG_FREE(data_filtered);
-    RPNG_FREE(sde);
-
-    if ((comp_data != NULL) && (comp_data_size > 0))
-    {
-        idat_data = comp_data;
-        *output_size = comp_data_size;
-        RPNG_LOG("INFO: Image data deflated successfully: %i bytes -> %i bytes\n", data_filtered_size, comp_data_size);
-    }
-    else RPNG_LOG("INFO: Image data deflating failed\n");
-
-    return idat_data;
+#endif
 }
 
 // Decompress and unfilter image data (IDAT)
 static char *rpng_inflate_image_data(char *image_data, int image_data_size, int width, int height, int pixel_size)
 {
     char *image_data_unfiltered = NULL;
-    char *image_data_filtered = (char *)RPNG_CALLOC(RPNG_MAX_OUTPUT_SIZE, 1); // WARNING: Allocate enough memory to load full image decompressed
+
+    // Decompressed data size is known from image size, scanlines with one extra byte for filter type
+    // NOTE: Zeroed buffer, in case data is truncated, missing scanlines are just filled with 0
+    // WARNING: External inflate (not rpng internal copy) does not check output capacity on matches copy
+    int scanline_size = width*pixel_size;
+    int image_data_filtered_size = (scanline_size + 1)*height;
+    if ((image_data_filtered_size <= 0) || (image_data_filtered_size > RPNG_MAX_OUTPUT_SIZE)) return NULL;
+    char *image_data_filtered = (char *)RPNG_CALLOC(image_data_filtered_size, 1);
+    if (image_data_filtered == NULL) return NULL;
 
     // Decompress IDAT chunk data
-    int image_data_decomp_size = zsinflate(image_data_filtered, RPNG_MAX_OUTPUT_SIZE, image_data, image_data_size);
+    int image_data_decomp_size = zsinflate(image_data_filtered, image_data_filtered_size, image_data, image_data_size);
 
     RPNG_LOG("INFO: IDAT data decompressed: %i -> %i\n", image_data_size, image_data_decomp_size);
 
@@ -2158,48 +3211,196 @@ static char *rpng_inflate_image_data(char *image_data, int image_data_size, int
         // We must undo that image prefiltering for every scanline
 
         // Image data reverse pre-processing for filter type
-        //int pixel_size = *color_channels*(*bit_depth/8);
-        int scanline_size = width*pixel_size;
-        image_data_unfiltered = (char *)RPNG_CALLOC(image_data_decomp_size, 1);  // Actually data unfiltered size should be smaller
+        image_data_unfiltered = (char *)RPNG_CALLOC(scanline_size*height, 1);
+
+        // Reverse scanlines filters, we must discard first byte = filter type
+        for (int y = 0; y < height; y++)
+        {
+            const unsigned char *filtered = (const unsigned char *)image_data_filtered + (1 + scanline_size)*y;
+            unsigned char *prev = (y > 0)? (unsigned char *)image_data_unfiltered + scanline_size*(y - 1) : NULL;
+
+            rpng_unfilter_scanline(filtered + 1, prev, (unsigned char *)image_data_unfiltered + scanline_size*y, scanline_size, pixel_size, filtered[0]);
+        }
+    }
+
+    RPNG_FREE(image_data_filtered);
+
+    return image_data_unfiltered;
+}
+
+// Decompress and unfilter image data scanline by scanline, rows provided to callback (streaming)
+// NOTE: Decompression buffer holds deflate window (32KB) and at least two scanlines, only full scanlines are unfiltered
+static int rpng_inflate_image_rows(const char *image_data, int image_data_size, int scanline_size, int height, int pixel_size, rpng_row_callback callback, void *user_data)
+{
+    // Zlib stream: 2 bytes header + deflate data + 4 bytes Adler-32
+    if ((image_data_size < 6) || (scanline_size <= 0) || (height <= 0)) return 0;
+
+    int row_size = scanline_size + 1;
+    int stream_space = (2*row_size > RPNG_INFLATE_WINDOW_SIZE*2)? 2*row_size : RPNG_INFLATE_WINDOW_SIZE*2;
+    if ((long long)RPNG_INFLATE_WINDOW_SIZE + stream_space + 2*scanline_size > RPNG_MAX_OUTPUT_SIZE) return 0;
+
+    // NOTE: Sliding copies the window, decompression space (>= 64KB) keeps copies under the size decompressed,
+    // small images decompressed at once, no flush required
+    int buffer_size = RPNG_INFLATE_WINDOW_SIZE + stream_space;
+    if ((long long)row_size*height + SINFL_FLUSH_MARGIN < buffer_size) buffer_size = row_size*height + SINFL_FLUSH_MARGIN;
+    unsigned char *buffer = (unsigned char *)RPNG_MALLOC(buffer_size + 2*scanline_size);
+    if (buffer == NULL) return 0;
+
+    rpng_inflate_stream stream = { 0 };
+    stream.buffer = buffer;
+    stream.next = buffer;
+    stream.current = buffer + buffer_size;
+    stream.previous = NULL;
+    stream.scanline_size = scanline_size;
+    stream.pixel_size = pixel_size;
+    stream.height = height;
+    stream.adler = 1;
+    stream.callback = callback;
+    stream.user_data = user_data;
+
+    const unsigned char *data = (const unsigned char *)image_data;
+    int size = sinfl_decompress(buffer, buffer_size, data + 2, image_data_size - 2, rpng_inflate_stream_flush, &stream);
+
+    // Last scanlines decompressed, not flushed yet
+    if ((size >= 0) && (rpng_inflate_stream_flush(&stream, buffer + size) != NULL))
+    {
+        const unsigned char *eob = data + image_data_size - 4;
+        unsigned int adler = ((unsigned int)eob[0] << 24) | ((unsigned int)eob[1] << 16) | ((unsigned int)eob[2] << 8) | (unsigned int)eob[3];
 
-        int current_filter = 0;
-        int out = 0, x = 0, a = 0, b = 0, c = 0;
+        RPNG_LOG("INFO: IDAT data decompressed (streamed): %i -> %i rows\n", image_data_size, stream.y);
 
-        // Reverse scanlines filters
-        for (int y = 0; y < height; y++)   // Move scanline by scanline, we must discard first byte = current_filter
+        if (stream.y < height) RPNG_LOG("WARNING: IDAT image data truncated, %i rows missing\n", height - stream.y);
+        else if (stream.adler != adler)
         {
-            current_filter = (int)image_data_filtered[(1 + scanline_size)*y];
+            RPNG_LOG("WARNING: IDAT image data Adler-32 not valid, image data could be corrupted\n");
+            stream.y = -1;
+        }
+    }
 
-            for (int p = 0; p < scanline_size; p++)
-            {
-                // x = current byte
-                // a = left pixel byte (from current)
-                // b = above pixel byte (from current)
-                // c = left pixel byte (from b)
-                x = (int)(image_data_filtered[(1 + scanline_size)*y + 1 + p]);
-                a = (p >= pixel_size) ? (int)(image_data_unfiltered[scanline_size*y + p - pixel_size]) : 0;
-                b = (y > 0) ? (int)(image_data_unfiltered[scanline_size*(y - 1) + p]) : 0;
-                c = (y > 0) ? ((p >= pixel_size) ? (int)(image_data_unfiltered[scanline_size*(y - 1) + p - pixel_size]) : 0) : 0;
-
-                switch (current_filter)
-                {
-                    case 0: out = x; break;         // Filter type 0: None (Usually used for indexed images)
-                    case 1: out = x + a; break;     // Filter type 1: Sub
-                    case 2: out = x + b; break;     // Filter type 2: Up
-                    case 3: out = x + ((a + b)>>1); break;    // Filter type 3: Average
-                    case 4: out = x + rpng_paeth_predictor(a, b, c); break;  // Filter type 4: Paeth
-                    default: break;
-                }
+    RPNG_FREE(buffer);
 
-                // Register scanline unfiltered values, byte by byte
-                image_data_unfiltered[y*scanline_size + p] = (char)out;
-            }
+    return stream.y;
+}
+
+// Unfilter complete scanlines decompressed, slide decompression buffer keeping deflate window
+// NOTE: Returns new output position for decompression, NULL if callback requested stop
+static unsigned char *rpng_inflate_stream_flush(void *data, unsigned char *out)
+{
+    rpng_inflate_stream *stream = (rpng_inflate_stream *)data;
+    int row_size = stream->scanline_size + 1;
+
+    while ((stream->y < stream->height) && ((out - stream->next) >= row_size))
+    {
+        stream->adler = sinfl_adler32(stream->adler, stream->next, row_size);
+        rpng_unfilter_scanline(stream->next + 1, stream->previous, stream->current, stream->scanline_size, stream->pixel_size, stream->next[0]);
+
+        bool next_row = stream->callback((const char *)stream->current, stream->y, stream->user_data);
+
+        // Swap scanlines, previous scanline is required for unfiltering
+        unsigned char *scanline = (stream->previous != NULL)? stream->previous : stream->current + stream->scanline_size;
+        stream->previous = stream->current;
+        stream->current = scanline;
+        stream->next += row_size;
+        stream->y++;
+
+        if (!next_row) return NULL;
+    }
+
+    // Data after last scanline is not expected, just consumed for checksum
+    if (stream->y >= stream->height)
+    {
+        stream->adler = sinfl_adler32(stream->adler, stream->next, (int)(out - stream->next));
+        stream->next = out;
+    }
+
+    // Slide buffer, keeping deflate window and pending scanline data
+    unsigned char *keep = out - RPNG_INFLATE_WINDOW_SIZE;
+    if (stream->next < keep) keep = stream->next;
+
+    if (keep > stream->buffer)
+    {
+        int shift = (int)(keep - stream->buffer);
+        memmove(stream->buffer, keep, out - keep);
+        stream->next -= shift;
+        out -= shift;
+    }
+
+    return out;
+}
+
+// Unfilter scanline (filter type byte not included), previous scanline unfiltered required (NULL for first scanline)
+static void rpng_unfilter_scanline(const unsigned char *filtered, const unsigned char *prev, unsigned char *out, int size, int pixel_size, int filter_type)
+{
+    int value = 0, x = 0, a = 0, b = 0, c = 0;
+
+    for (int p = 0; p < size; p++)
+    {
+        // x = current byte
+        // a = left pixel byte (from current)
+        // b = above pixel byte (from current)
+        // c = left pixel byte (from b)
+        // NOTE: Bytes must be read as unsigned for Average and Paeth filters
+        x = filtered[p];
+        a = (p >= pixel_size)? out[p - pixel_size] : 0;
+        b = (prev != NULL)? prev[p] : 0;
+        c = ((prev != NULL) && (p >= pixel_size))? prev[p - pixel_size] : 0;
+
+        switch (filter_type)
+        {
+            case 0: value = x; break;           // Filter type 0: None (Usually used for indexed images)
+            case 1: value = x + a; break;       // Filter type 1: Sub
+            case 2: value = x + b; break;       // Filter type 2: Up
+            case 3: value = x + ((a + b)>>1); break;    // Filter type 3: Average
+            case 4: value = x + rpng_paeth_predictor(a, b, c); break;  // Filter type 4: Paeth
+            default: break;
         }
 
-        RPNG_FREE(image_data_filtered);
+        // Register scanline unfiltered values, byte by byte
+        out[p] = (unsigned char)value;
     }
+}
 
-    return image_data_unfiltered;
+// Insert chunk into session at position, data copied
+static void rpng_session_insert(rpng_session *session, int position, rpng_chunk chunk)
+{
+    // Grow session chunks list on demand
+    if (session->count >= session->capacity)
+    {
+        int capacity = session->capacity*2;
+        rpng_chunk *chunks = (rpng_chunk *)RPNG_REALLOC(session->chunks, capacity*sizeof(rpng_chunk));
+        if (chunks == NULL) return;
+        session->chunks = chunks;
+        bool *chunks_owned = (bool *)RPNG_REALLOC(session->chunks_owned, capacity*sizeof(bool));
+        if (chunks_owned == NULL) return;
+        session->chunks_owned = chunks_owned;
+        session->capacity = capacity;
+    }
+
+    rpng_chunk copy = chunk;
+    copy.data = (char *)RPNG_MALLOC((chunk.length > 0)? chunk.length : 1);
+    if (chunk.length > 0) memcpy(copy.data, chunk.data, chunk.length);
+    copy.crc = 0;       // Computed on commit
+
+    memmove(session->chunks + position + 1, session->chunks + position, (session->count - position)*sizeof(rpng_chunk));
+    memmove(session->chunks_owned + position + 1, session->chunks_owned + position, (session->count - position)*sizeof(bool));
+    session->chunks[position] = copy;
+    session->chunks_owned[position] = true;
+    session->count++;
+}
+
+// Delete chunk from session at position
+// NOTE: Critical chunks IHDR and IEND are never removed from session
+static void rpng_session_delete(rpng_session *session, int position)
+{
+    if ((memcmp(session->chunks[position].type, "IHDR", 4) == 0) || (memcmp(session->chunks[position].type, "IEND", 4) == 0)) return;
+
+    if (session->chunks_owned[position]) RPNG_FREE(session->chunks[position].data);
+
+    memmove(session->chunks + position, session->chunks + position + 1, (session->count - position - 1)*sizeof(rpng_chunk));
+    memmove(session->chunks_owned + position, session->chunks_owned + position + 1, (session->count - position - 1)*sizeof(bool));
+    session->count--;
+
+    if (position < session->insert_position) session->insert_position--;
 }
 
 // Swap integer from big<->little endian
@@ -2222,9 +3423,25 @@ static unsigned int swap_endian(unsigned int value)
 // Compute CRC32
 static unsigned int compute_crc32(unsigned char *buffer, int size)
 {
-    static unsigned int crc_table[256] = {
+    return ~update_crc32(~0u, buffer, size);
+}
+
+// Compute CRC32 over chunk type + data, no need to join them in a buffer
+static unsigned int compute_crc32_chunk(const char *type, const char *data, int size)
+{
+    unsigned int crc = update_crc32(~0u, (const unsigned char *)type, 4);
+    if (size > 0) crc = update_crc32(crc, (const unsigned char *)data, size);
+
+    return ~crc;
+}
+
+// CRC32 lookup tables for slicing-by-8, table[0] is the classic byte-at-a-time table
+// NOTE: table[k][n] = (table[k - 1][n] >> 8) ^ table[0][table[k - 1][n] & 0xff], CRC of byte n followed by k zero bytes
+// REF: https://www.w3.org/TR/PNG/#D-CRCAppendix
+static const unsigned int crc32_tables[8][256] = {
+    {
         0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
-        0x0eDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988, 0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
+        0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988, 0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
         0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE, 0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
         0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC, 0x14015C4F, 0x63066CD9, 0xFA0F3D63, 0x8D080DF5,
         0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172, 0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B,
@@ -2255,13 +3472,435 @@ static unsigned int compute_crc32(unsigned char *buffer, int size)
         0xAED16A4A, 0xD9D65ADC, 0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
         0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
         0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D
-    };
+    },
+    {
+        0x00000000, 0x191B3141, 0x32366282, 0x2B2D53C3, 0x646CC504, 0x7D77F445, 0x565AA786, 0x4F4196C7,
+        0xC8D98A08, 0xD1C2BB49, 0xFAEFE88A, 0xE3F4D9CB, 0xACB54F0C, 0xB5AE7E4D, 0x9E832D8E, 0x87981CCF,
+        0x4AC21251, 0x53D92310, 0x78F470D3, 0x61EF4192, 0x2EAED755, 0x37B5E614, 0x1C98B5D7, 0x05838496,
+        0x821B9859, 0x9B00A918, 0xB02DFADB, 0xA936CB9A, 0xE6775D5D, 0xFF6C6C1C, 0xD4413FDF, 0xCD5A0E9E,
+        0x958424A2, 0x8C9F15E3, 0xA7B24620, 0xBEA97761, 0xF1E8E1A6, 0xE8F3D0E7, 0xC3DE8324, 0xDAC5B265,
+        0x5D5DAEAA, 0x44469FEB, 0x6F6BCC28, 0x7670FD69, 0x39316BAE, 0x202A5AEF, 0x0B07092C, 0x121C386D,
+        0xDF4636F3, 0xC65D07B2, 0xED705471, 0xF46B6530, 0xBB2AF3F7, 0xA231C2B6, 0x891C9175, 0x9007A034,
+        0x179FBCFB, 0x0E848DBA, 0x25A9DE79, 0x3CB2EF38, 0x73F379FF, 0x6AE848BE, 0x41C51B7D, 0x58DE2A3C,
+        0xF0794F05, 0xE9627E44, 0xC24F2D87, 0xDB541CC6, 0x94158A01, 0x8D0EBB40, 0xA623E883, 0xBF38D9C2,
+        0x38A0C50D, 0x21BBF44C, 0x0A96A78F, 0x138D96CE, 0x5CCC0009, 0x45D73148, 0x6EFA628B, 0x77E153CA,
+        0xBABB5D54, 0xA3A06C15, 0x888D3FD6, 0x91960E97, 0xDED79850, 0xC7CCA911, 0xECE1FAD2, 0xF5FACB93,
+        0x7262D75C, 0x6B79E61D, 0x4054B5DE, 0x594F849F, 0x160E1258, 0x0F152319, 0x243870DA, 0x3D23419B,
+        0x65FD6BA7, 0x7CE65AE6, 0x57CB0925, 0x4ED03864, 0x0191AEA3, 0x188A9FE2, 0x33A7CC21, 0x2ABCFD60,
+        0xAD24E1AF, 0xB43FD0EE, 0x9F12832D, 0x8609B26C, 0xC94824AB, 0xD05315EA, 0xFB7E4629, 0xE2657768,
+        0x2F3F79F6, 0x362448B7, 0x1D091B74, 0x04122A35, 0x4B53BCF2, 0x52488DB3, 0x7965DE70, 0x607EEF31,
+        0xE7E6F3FE, 0xFEFDC2BF, 0xD5D0917C, 0xCCCBA03D, 0x838A36FA, 0x9A9107BB, 0xB1BC5478, 0xA8A76539,
+        0x3B83984B, 0x2298A90A, 0x09B5FAC9, 0x10AECB88, 0x5FEF5D4F, 0x46F46C0E, 0x6DD93FCD, 0x74C20E8C,
+        0xF35A1243, 0xEA412302, 0xC16C70C1, 0xD8774180, 0x9736D747, 0x8E2DE606, 0xA500B5C5, 0xBC1B8484,
+        0x71418A1A, 0x685ABB5B, 0x4377E898, 0x5A6CD9D9, 0x152D4F1E, 0x0C367E5F, 0x271B2D9C, 0x3E001CDD,
+        0xB9980012, 0xA0833153, 0x8BAE6290, 0x92B553D1, 0xDDF4C516, 0xC4EFF457, 0xEFC2A794, 0xF6D996D5,
+        0xAE07BCE9, 0xB71C8DA8, 0x9C31DE6B, 0x852AEF2A, 0xCA6B79ED, 0xD37048AC, 0xF85D1B6F, 0xE1462A2E,
+        0x66DE36E1, 0x7FC507A0, 0x54E85463, 0x4DF36522, 0x02B2F3E5, 0x1BA9C2A4, 0x30849167, 0x299FA026,
+        0xE4C5AEB8, 0xFDDE9FF9, 0xD6F3CC3A, 0xCFE8FD7B, 0x80A96BBC, 0x99B25AFD, 0xB29F093E, 0xAB84387F,
+        0x2C1C24B0, 0x350715F1, 0x1E2A4632, 0x07317773, 0x4870E1B4, 0x516BD0F5, 0x7A468336, 0x635DB277,
+        0xCBFAD74E, 0xD2E1E60F, 0xF9CCB5CC, 0xE0D7848D, 0xAF96124A, 0xB68D230B, 0x9DA070C8, 0x84BB4189,
+        0x03235D46, 0x1A386C07, 0x31153FC4, 0x280E0E85, 0x674F9842, 0x7E54A903, 0x5579FAC0, 0x4C62CB81,
+        0x8138C51F, 0x9823F45E, 0xB30EA79D, 0xAA1596DC, 0xE554001B, 0xFC4F315A, 0xD7626299, 0xCE7953D8,
+        0x49E14F17, 0x50FA7E56, 0x7BD72D95, 0x62CC1CD4, 0x2D8D8A13, 0x3496BB52, 0x1FBBE891, 0x06A0D9D0,
+        0x5E7EF3EC, 0x4765C2AD, 0x6C48916E, 0x7553A02F, 0x3A1236E8, 0x230907A9, 0x0824546A, 0x113F652B,
+        0x96A779E4, 0x8FBC48A5, 0xA4911B66, 0xBD8A2A27, 0xF2CBBCE0, 0xEBD08DA1, 0xC0FDDE62, 0xD9E6EF23,
+        0x14BCE1BD, 0x0DA7D0FC, 0x268A833F, 0x3F91B27E, 0x70D024B9, 0x69CB15F8, 0x42E6463B, 0x5BFD777A,
+        0xDC656BB5, 0xC57E5AF4, 0xEE530937, 0xF7483876, 0xB809AEB1, 0xA1129FF0, 0x8A3FCC33, 0x9324FD72
+    },
+    {
+        0x00000000, 0x01C26A37, 0x0384D46E, 0x0246BE59, 0x0709A8DC, 0x06CBC2EB, 0x048D7CB2, 0x054F1685,
+        0x0E1351B8, 0x0FD13B8F, 0x0D9785D6, 0x0C55EFE1, 0x091AF964, 0x08D89353, 0x0A9E2D0A, 0x0B5C473D,
+        0x1C26A370, 0x1DE4C947, 0x1FA2771E, 0x1E601D29, 0x1B2F0BAC, 0x1AED619B, 0x18ABDFC2, 0x1969B5F5,
+        0x1235F2C8, 0x13F798FF, 0x11B126A6, 0x10734C91, 0x153C5A14, 0x14FE3023, 0x16B88E7A, 0x177AE44D,
+        0x384D46E0, 0x398F2CD7, 0x3BC9928E, 0x3A0BF8B9, 0x3F44EE3C, 0x3E86840B, 0x3CC03A52, 0x3D025065,
+        0x365E1758, 0x379C7D6F, 0x35DAC336, 0x3418A901, 0x3157BF84, 0x3095D5B3, 0x32D36BEA, 0x331101DD,
+        0x246BE590, 0x25A98FA7, 0x27EF31FE, 0x262D5BC9, 0x23624D4C, 0x22A0277B, 0x20E69922, 0x2124F315,
+        0x2A78B428, 0x2BBADE1F, 0x29FC6046, 0x283E0A71, 0x2D711CF4, 0x2CB376C3, 0x2EF5C89A, 0x2F37A2AD,
+        0x709A8DC0, 0x7158E7F7, 0x731E59AE, 0x72DC3399, 0x7793251C, 0x76514F2B, 0x7417F172, 0x75D59B45,
+        0x7E89DC78, 0x7F4BB64F, 0x7D0D0816, 0x7CCF6221, 0x798074A4, 0x78421E93, 0x7A04A0CA, 0x7BC6CAFD,
+        0x6CBC2EB0, 0x6D7E4487, 0x6F38FADE, 0x6EFA90E9, 0x6BB5866C, 0x6A77EC5B, 0x68315202, 0x69F33835,
+        0x62AF7F08, 0x636D153F, 0x612BAB66, 0x60E9C151, 0x65A6D7D4, 0x6464BDE3, 0x662203BA, 0x67E0698D,
+        0x48D7CB20, 0x4915A117, 0x4B531F4E, 0x4A917579, 0x4FDE63FC, 0x4E1C09CB, 0x4C5AB792, 0x4D98DDA5,
+        0x46C49A98, 0x4706F0AF, 0x45404EF6, 0x448224C1, 0x41CD3244, 0x400F5873, 0x4249E62A, 0x438B8C1D,
+        0x54F16850, 0x55330267, 0x5775BC3E, 0x56B7D609, 0x53F8C08C, 0x523AAABB, 0x507C14E2, 0x51BE7ED5,
+        0x5AE239E8, 0x5B2053DF, 0x5966ED86, 0x58A487B1, 0x5DEB9134, 0x5C29FB03, 0x5E6F455A, 0x5FAD2F6D,
+        0xE1351B80, 0xE0F771B7, 0xE2B1CFEE, 0xE373A5D9, 0xE63CB35C, 0xE7FED96B, 0xE5B86732, 0xE47A0D05,
+        0xEF264A38, 0xEEE4200F, 0xECA29E56, 0xED60F461, 0xE82FE2E4, 0xE9ED88D3, 0xEBAB368A, 0xEA695CBD,
+        0xFD13B8F0, 0xFCD1D2C7, 0xFE976C9E, 0xFF5506A9, 0xFA1A102C, 0xFBD87A1B, 0xF99EC442, 0xF85CAE75,
+        0xF300E948, 0xF2C2837F, 0xF0843D26, 0xF1465711, 0xF4094194, 0xF5CB2BA3, 0xF78D95FA, 0xF64FFFCD,
+        0xD9785D60, 0xD8BA3757, 0xDAFC890E, 0xDB3EE339, 0xDE71F5BC, 0xDFB39F8B, 0xDDF521D2, 0xDC374BE5,
+        0xD76B0CD8, 0xD6A966EF, 0xD4EFD8B6, 0xD52DB281, 0xD062A404, 0xD1A0CE33, 0xD3E6706A, 0xD2241A5D,
+        0xC55EFE10, 0xC49C9427, 0xC6DA2A7E, 0xC7184049, 0xC25756CC, 0xC3953CFB, 0xC1D382A2, 0xC011E895,
+        0xCB4DAFA8, 0xCA8FC59F, 0xC8C97BC6, 0xC90B11F1, 0xCC440774, 0xCD866D43, 0xCFC0D31A, 0xCE02B92D,
+        0x91AF9640, 0x906DFC77, 0x922B422E, 0x93E92819, 0x96A63E9C, 0x976454AB, 0x9522EAF2, 0x94E080C5,
+        0x9FBCC7F8, 0x9E7EADCF, 0x9C381396, 0x9DFA79A1, 0x98B56F24, 0x99770513, 0x9B31BB4A, 0x9AF3D17D,
+        0x8D893530, 0x8C4B5F07, 0x8E0DE15E, 0x8FCF8B69, 0x8A809DEC, 0x8B42F7DB, 0x89044982, 0x88C623B5,
+        0x839A6488, 0x82580EBF, 0x801EB0E6, 0x81DCDAD1, 0x8493CC54, 0x8551A663, 0x8717183A, 0x86D5720D,
+        0xA9E2D0A0, 0xA820BA97, 0xAA6604CE, 0xABA46EF9, 0xAEEB787C, 0xAF29124B, 0xAD6FAC12, 0xACADC625,
+        0xA7F18118, 0xA633EB2F, 0xA4755576, 0xA5B73F41, 0xA0F829C4, 0xA13A43F3, 0xA37CFDAA, 0xA2BE979D,
+        0xB5C473D0, 0xB40619E7, 0xB640A7BE, 0xB782CD89, 0xB2CDDB0C, 0xB30FB13B, 0xB1490F62, 0xB08B6555,
+        0xBBD72268, 0xBA15485F, 0xB853F606, 0xB9919C31, 0xBCDE8AB4, 0xBD1CE083, 0xBF5A5EDA, 0xBE9834ED
+    },
+    {
+        0x00000000, 0xB8BC6765, 0xAA09C88B, 0x12B5AFEE, 0x8F629757, 0x37DEF032, 0x256B5FDC, 0x9DD738B9,
+        0xC5B428EF, 0x7D084F8A, 0x6FBDE064, 0xD7018701, 0x4AD6BFB8, 0xF26AD8DD, 0xE0DF7733, 0x58631056,
+        0x5019579F, 0xE8A530FA, 0xFA109F14, 0x42ACF871, 0xDF7BC0C8, 0x67C7A7AD, 0x75720843, 0xCDCE6F26,
+        0x95AD7F70, 0x2D111815, 0x3FA4B7FB, 0x8718D09E, 0x1ACFE827, 0xA2738F42, 0xB0C620AC, 0x087A47C9,
+        0xA032AF3E, 0x188EC85B, 0x0A3B67B5, 0xB28700D0, 0x2F503869, 0x97EC5F0C, 0x8559F0E2, 0x3DE59787,
+        0x658687D1, 0xDD3AE0B4, 0xCF8F4F5A, 0x7733283F, 0xEAE41086, 0x525877E3, 0x40EDD80D, 0xF851BF68,
+        0xF02BF8A1, 0x48979FC4, 0x5A22302A, 0xE29E574F, 0x7F496FF6, 0xC7F50893, 0xD540A77D, 0x6DFCC018,
+        0x359FD04E, 0x8D23B72B, 0x9F9618C5, 0x272A7FA0, 0xBAFD4719, 0x0241207C, 0x10F48F92, 0xA848E8F7,
+        0x9B14583D, 0x23A83F58, 0x311D90B6, 0x89A1F7D3, 0x1476CF6A, 0xACCAA80F, 0xBE7F07E1, 0x06C36084,
+        0x5EA070D2, 0xE61C17B7, 0xF4A9B859, 0x4C15DF3C, 0xD1C2E785, 0x697E80E0, 0x7BCB2F0E, 0xC377486B,
+        0xCB0D0FA2, 0x73B168C7, 0x6104C729, 0xD9B8A04C, 0x446F98F5, 0xFCD3FF90, 0xEE66507E, 0x56DA371B,
+        0x0EB9274D, 0xB6054028, 0xA4B0EFC6, 0x1C0C88A3, 0x81DBB01A, 0x3967D77F, 0x2BD27891, 0x936E1FF4,
+        0x3B26F703, 0x839A9066, 0x912F3F88, 0x299358ED, 0xB4446054, 0x0CF80731, 0x1E4DA8DF, 0xA6F1CFBA,
+        0xFE92DFEC, 0x462EB889, 0x549B1767, 0xEC277002, 0x71F048BB, 0xC94C2FDE, 0xDBF98030, 0x6345E755,
+        0x6B3FA09C, 0xD383C7F9, 0xC1366817, 0x798A0F72, 0xE45D37CB, 0x5CE150AE, 0x4E54FF40, 0xF6E89825,
+        0xAE8B8873, 0x1637EF16, 0x048240F8, 0xBC3E279D, 0x21E91F24, 0x99557841, 0x8BE0D7AF, 0x335CB0CA,
+        0xED59B63B, 0x55E5D15E, 0x47507EB0, 0xFFEC19D5, 0x623B216C, 0xDA874609, 0xC832E9E7, 0x708E8E82,
+        0x28ED9ED4, 0x9051F9B1, 0x82E4565F, 0x3A58313A, 0xA78F0983, 0x1F336EE6, 0x0D86C108, 0xB53AA66D,
+        0xBD40E1A4, 0x05FC86C1, 0x1749292F, 0xAFF54E4A, 0x322276F3, 0x8A9E1196, 0x982BBE78, 0x2097D91D,
+        0x78F4C94B, 0xC048AE2E, 0xD2FD01C0, 0x6A4166A5, 0xF7965E1C, 0x4F2A3979, 0x5D9F9697, 0xE523F1F2,
+        0x4D6B1905, 0xF5D77E60, 0xE762D18E, 0x5FDEB6EB, 0xC2098E52, 0x7AB5E937, 0x680046D9, 0xD0BC21BC,
+        0x88DF31EA, 0x3063568F, 0x22D6F961, 0x9A6A9E04, 0x07BDA6BD, 0xBF01C1D8, 0xADB46E36, 0x15080953,
+        0x1D724E9A, 0xA5CE29FF, 0xB77B8611, 0x0FC7E174, 0x9210D9CD, 0x2AACBEA8, 0x38191146, 0x80A57623,
+        0xD8C66675, 0x607A0110, 0x72CFAEFE, 0xCA73C99B, 0x57A4F122, 0xEF189647, 0xFDAD39A9, 0x45115ECC,
+        0x764DEE06, 0xCEF18963, 0xDC44268D, 0x64F841E8, 0xF92F7951, 0x41931E34, 0x5326B1DA, 0xEB9AD6BF,
+        0xB3F9C6E9, 0x0B45A18C, 0x19F00E62, 0xA14C6907, 0x3C9B51BE, 0x842736DB, 0x96929935, 0x2E2EFE50,
+        0x2654B999, 0x9EE8DEFC, 0x8C5D7112, 0x34E11677, 0xA9362ECE, 0x118A49AB, 0x033FE645, 0xBB838120,
+        0xE3E09176, 0x5B5CF613, 0x49E959FD, 0xF1553E98, 0x6C820621, 0xD43E6144, 0xC68BCEAA, 0x7E37A9CF,
+        0xD67F4138, 0x6EC3265D, 0x7C7689B3, 0xC4CAEED6, 0x591DD66F, 0xE1A1B10A, 0xF3141EE4, 0x4BA87981,
+        0x13CB69D7, 0xAB770EB2, 0xB9C2A15C, 0x017EC639, 0x9CA9FE80, 0x241599E5, 0x36A0360B, 0x8E1C516E,
+        0x866616A7, 0x3EDA71C2, 0x2C6FDE2C, 0x94D3B949, 0x090481F0, 0xB1B8E695, 0xA30D497B, 0x1BB12E1E,
+        0x43D23E48, 0xFB6E592D, 0xE9DBF6C3, 0x516791A6, 0xCCB0A91F, 0x740CCE7A, 0x66B96194, 0xDE0506F1
+    },
+    {
+        0x00000000, 0x3D6029B0, 0x7AC05360, 0x47A07AD0, 0xF580A6C0, 0xC8E08F70, 0x8F40F5A0, 0xB220DC10,
+        0x30704BC1, 0x0D106271, 0x4AB018A1, 0x77D03111, 0xC5F0ED01, 0xF890C4B1, 0xBF30BE61, 0x825097D1,
+        0x60E09782, 0x5D80BE32, 0x1A20C4E2, 0x2740ED52, 0x95603142, 0xA80018F2, 0xEFA06222, 0xD2C04B92,
+        0x5090DC43, 0x6DF0F5F3, 0x2A508F23, 0x1730A693, 0xA5107A83, 0x98705333, 0xDFD029E3, 0xE2B00053,
+        0xC1C12F04, 0xFCA106B4, 0xBB017C64, 0x866155D4, 0x344189C4, 0x0921A074, 0x4E81DAA4, 0x73E1F314,
+        0xF1B164C5, 0xCCD14D75, 0x8B7137A5, 0xB6111E15, 0x0431C205, 0x3951EBB5, 0x7EF19165, 0x4391B8D5,
+        0xA121B886, 0x9C419136, 0xDBE1EBE6, 0xE681C256, 0x54A11E46, 0x69C137F6, 0x2E614D26, 0x13016496,
+        0x9151F347, 0xAC31DAF7, 0xEB91A027, 0xD6F18997, 0x64D15587, 0x59B17C37, 0x1E1106E7, 0x23712F57,
+        0x58F35849, 0x659371F9, 0x22330B29, 0x1F532299, 0xAD73FE89, 0x9013D739, 0xD7B3ADE9, 0xEAD38459,
+        0x68831388, 0x55E33A38, 0x124340E8, 0x2F236958, 0x9D03B548, 0xA0639CF8, 0xE7C3E628, 0xDAA3CF98,
+        0x3813CFCB, 0x0573E67B, 0x42D39CAB, 0x7FB3B51B, 0xCD93690B, 0xF0F340BB, 0xB7533A6B, 0x8A3313DB,
+        0x0863840A, 0x3503ADBA, 0x72A3D76A, 0x4FC3FEDA, 0xFDE322CA, 0xC0830B7A, 0x872371AA, 0xBA43581A,
+        0x9932774D, 0xA4525EFD, 0xE3F2242D, 0xDE920D9D, 0x6CB2D18D, 0x51D2F83D, 0x167282ED, 0x2B12AB5D,
+        0xA9423C8C, 0x9422153C, 0xD3826FEC, 0xEEE2465C, 0x5CC29A4C, 0x61A2B3FC, 0x2602C92C, 0x1B62E09C,
+        0xF9D2E0CF, 0xC4B2C97F, 0x8312B3AF, 0xBE729A1F, 0x0C52460F, 0x31326FBF, 0x7692156F, 0x4BF23CDF,
+        0xC9A2AB0E, 0xF4C282BE, 0xB362F86E, 0x8E02D1DE, 0x3C220DCE, 0x0142247E, 0x46E25EAE, 0x7B82771E,
+        0xB1E6B092, 0x8C869922, 0xCB26E3F2, 0xF646CA42, 0x44661652, 0x79063FE2, 0x3EA64532, 0x03C66C82,
+        0x8196FB53, 0xBCF6D2E3, 0xFB56A833, 0xC6368183, 0x74165D93, 0x49767423, 0x0ED60EF3, 0x33B62743,
+        0xD1062710, 0xEC660EA0, 0xABC67470, 0x96A65DC0, 0x248681D0, 0x19E6A860, 0x5E46D2B0, 0x6326FB00,
+        0xE1766CD1, 0xDC164561, 0x9BB63FB1, 0xA6D61601, 0x14F6CA11, 0x2996E3A1, 0x6E369971, 0x5356B0C1,
+        0x70279F96, 0x4D47B626, 0x0AE7CCF6, 0x3787E546, 0x85A73956, 0xB8C710E6, 0xFF676A36, 0xC2074386,
+        0x4057D457, 0x7D37FDE7, 0x3A978737, 0x07F7AE87, 0xB5D77297, 0x88B75B27, 0xCF1721F7, 0xF2770847,
+        0x10C70814, 0x2DA721A4, 0x6A075B74, 0x576772C4, 0xE547AED4, 0xD8278764, 0x9F87FDB4, 0xA2E7D404,
+        0x20B743D5, 0x1DD76A65, 0x5A7710B5, 0x67173905, 0xD537E515, 0xE857CCA5, 0xAFF7B675, 0x92979FC5,
+        0xE915E8DB, 0xD475C16B, 0x93D5BBBB, 0xAEB5920B, 0x1C954E1B, 0x21F567AB, 0x66551D7B, 0x5B3534CB,
+        0xD965A31A, 0xE4058AAA, 0xA3A5F07A, 0x9EC5D9CA, 0x2CE505DA, 0x11852C6A, 0x562556BA, 0x6B457F0A,
+        0x89F57F59, 0xB49556E9, 0xF3352C39, 0xCE550589, 0x7C75D999, 0x4115F029, 0x06B58AF9, 0x3BD5A349,
+        0xB9853498, 0x84E51D28, 0xC34567F8, 0xFE254E48, 0x4C059258, 0x7165BBE8, 0x36C5C138, 0x0BA5E888,
+        0x28D4C7DF, 0x15B4EE6F, 0x521494BF, 0x6F74BD0F, 0xDD54611F, 0xE03448AF, 0xA794327F, 0x9AF41BCF,
+        0x18A48C1E, 0x25C4A5AE, 0x6264DF7E, 0x5F04F6CE, 0xED242ADE, 0xD044036E, 0x97E479BE, 0xAA84500E,
+        0x4834505D, 0x755479ED, 0x32F4033D, 0x0F942A8D, 0xBDB4F69D, 0x80D4DF2D, 0xC774A5FD, 0xFA148C4D,
+        0x78441B9C, 0x4524322C, 0x028448FC, 0x3FE4614C, 0x8DC4BD5C, 0xB0A494EC, 0xF704EE3C, 0xCA64C78C
+    },
+    {
+        0x00000000, 0xCB5CD3A5, 0x4DC8A10B, 0x869472AE, 0x9B914216, 0x50CD91B3, 0xD659E31D, 0x1D0530B8,
+        0xEC53826D, 0x270F51C8, 0xA19B2366, 0x6AC7F0C3, 0x77C2C07B, 0xBC9E13DE, 0x3A0A6170, 0xF156B2D5,
+        0x03D6029B, 0xC88AD13E, 0x4E1EA390, 0x85427035, 0x9847408D, 0x531B9328, 0xD58FE186, 0x1ED33223,
+        0xEF8580F6, 0x24D95353, 0xA24D21FD, 0x6911F258, 0x7414C2E0, 0xBF481145, 0x39DC63EB, 0xF280B04E,
+        0x07AC0536, 0xCCF0D693, 0x4A64A43D, 0x81387798, 0x9C3D4720, 0x57619485, 0xD1F5E62B, 0x1AA9358E,
+        0xEBFF875B, 0x20A354FE, 0xA6372650, 0x6D6BF5F5, 0x706EC54D, 0xBB3216E8, 0x3DA66446, 0xF6FAB7E3,
+        0x047A07AD, 0xCF26D408, 0x49B2A6A6, 0x82EE7503, 0x9FEB45BB, 0x54B7961E, 0xD223E4B0, 0x197F3715,
+        0xE82985C0, 0x23755665, 0xA5E124CB, 0x6EBDF76E, 0x73B8C7D6, 0xB8E41473, 0x3E7066DD, 0xF52CB578,
+        0x0F580A6C, 0xC404D9C9, 0x4290AB67, 0x89CC78C2, 0x94C9487A, 0x5F959BDF, 0xD901E971, 0x125D3AD4,
+        0xE30B8801, 0x28575BA4, 0xAEC3290A, 0x659FFAAF, 0x789ACA17, 0xB3C619B2, 0x35526B1C, 0xFE0EB8B9,
+        0x0C8E08F7, 0xC7D2DB52, 0x4146A9FC, 0x8A1A7A59, 0x971F4AE1, 0x5C439944, 0xDAD7EBEA, 0x118B384F,
+        0xE0DD8A9A, 0x2B81593F, 0xAD152B91, 0x6649F834, 0x7B4CC88C, 0xB0101B29, 0x36846987, 0xFDD8BA22,
+        0x08F40F5A, 0xC3A8DCFF, 0x453CAE51, 0x8E607DF4, 0x93654D4C, 0x58399EE9, 0xDEADEC47, 0x15F13FE2,
+        0xE4A78D37, 0x2FFB5E92, 0xA96F2C3C, 0x6233FF99, 0x7F36CF21, 0xB46A1C84, 0x32FE6E2A, 0xF9A2BD8F,
+        0x0B220DC1, 0xC07EDE64, 0x46EAACCA, 0x8DB67F6F, 0x90B34FD7, 0x5BEF9C72, 0xDD7BEEDC, 0x16273D79,
+        0xE7718FAC, 0x2C2D5C09, 0xAAB92EA7, 0x61E5FD02, 0x7CE0CDBA, 0xB7BC1E1F, 0x31286CB1, 0xFA74BF14,
+        0x1EB014D8, 0xD5ECC77D, 0x5378B5D3, 0x98246676, 0x852156CE, 0x4E7D856B, 0xC8E9F7C5, 0x03B52460,
+        0xF2E396B5, 0x39BF4510, 0xBF2B37BE, 0x7477E41B, 0x6972D4A3, 0xA22E0706, 0x24BA75A8, 0xEFE6A60D,
+        0x1D661643, 0xD63AC5E6, 0x50AEB748, 0x9BF264ED, 0x86F75455, 0x4DAB87F0, 0xCB3FF55E, 0x006326FB,
+        0xF135942E, 0x3A69478B, 0xBCFD3525, 0x77A1E680, 0x6AA4D638, 0xA1F8059D, 0x276C7733, 0xEC30A496,
+        0x191C11EE, 0xD240C24B, 0x54D4B0E5, 0x9F886340, 0x828D53F8, 0x49D1805D, 0xCF45F2F3, 0x04192156,
+        0xF54F9383, 0x3E134026, 0xB8873288, 0x73DBE12D, 0x6EDED195, 0xA5820230, 0x2316709E, 0xE84AA33B,
+        0x1ACA1375, 0xD196C0D0, 0x5702B27E, 0x9C5E61DB, 0x815B5163, 0x4A0782C6, 0xCC93F068, 0x07CF23CD,
+        0xF6999118, 0x3DC542BD, 0xBB513013, 0x700DE3B6, 0x6D08D30E, 0xA65400AB, 0x20C07205, 0xEB9CA1A0,
+        0x11E81EB4, 0xDAB4CD11, 0x5C20BFBF, 0x977C6C1A, 0x8A795CA2, 0x41258F07, 0xC7B1FDA9, 0x0CED2E0C,
+        0xFDBB9CD9, 0x36E74F7C, 0xB0733DD2, 0x7B2FEE77, 0x662ADECF, 0xAD760D6A, 0x2BE27FC4, 0xE0BEAC61,
+        0x123E1C2F, 0xD962CF8A, 0x5FF6BD24, 0x94AA6E81, 0x89AF5E39, 0x42F38D9C, 0xC467FF32, 0x0F3B2C97,
+        0xFE6D9E42, 0x35314DE7, 0xB3A53F49, 0x78F9ECEC, 0x65FCDC54, 0xAEA00FF1, 0x28347D5F, 0xE368AEFA,
+        0x16441B82, 0xDD18C827, 0x5B8CBA89, 0x90D0692C, 0x8DD55994, 0x46898A31, 0xC01DF89F, 0x0B412B3A,
+        0xFA1799EF, 0x314B4A4A, 0xB7DF38E4, 0x7C83EB41, 0x6186DBF9, 0xAADA085C, 0x2C4E7AF2, 0xE712A957,
+        0x15921919, 0xDECECABC, 0x585AB812, 0x93066BB7, 0x8E035B0F, 0x455F88AA, 0xC3CBFA04, 0x089729A1,
+        0xF9C19B74, 0x329D48D1, 0xB4093A7F, 0x7F55E9DA, 0x6250D962, 0xA90C0AC7, 0x2F987869, 0xE4C4ABCC
+    },
+    {
+        0x00000000, 0xA6770BB4, 0x979F1129, 0x31E81A9D, 0xF44F2413, 0x52382FA7, 0x63D0353A, 0xC5A73E8E,
+        0x33EF4E67, 0x959845D3, 0xA4705F4E, 0x020754FA, 0xC7A06A74, 0x61D761C0, 0x503F7B5D, 0xF64870E9,
+        0x67DE9CCE, 0xC1A9977A, 0xF0418DE7, 0x56368653, 0x9391B8DD, 0x35E6B369, 0x040EA9F4, 0xA279A240,
+        0x5431D2A9, 0xF246D91D, 0xC3AEC380, 0x65D9C834, 0xA07EF6BA, 0x0609FD0E, 0x37E1E793, 0x9196EC27,
+        0xCFBD399C, 0x69CA3228, 0x582228B5, 0xFE552301, 0x3BF21D8F, 0x9D85163B, 0xAC6D0CA6, 0x0A1A0712,
+        0xFC5277FB, 0x5A257C4F, 0x6BCD66D2, 0xCDBA6D66, 0x081D53E8, 0xAE6A585C, 0x9F8242C1, 0x39F54975,
+        0xA863A552, 0x0E14AEE6, 0x3FFCB47B, 0x998BBFCF, 0x5C2C8141, 0xFA5B8AF5, 0xCBB39068, 0x6DC49BDC,
+        0x9B8CEB35, 0x3DFBE081, 0x0C13FA1C, 0xAA64F1A8, 0x6FC3CF26, 0xC9B4C492, 0xF85CDE0F, 0x5E2BD5BB,
+        0x440B7579, 0xE27C7ECD, 0xD3946450, 0x75E36FE4, 0xB044516A, 0x16335ADE, 0x27DB4043, 0x81AC4BF7,
+        0x77E43B1E, 0xD19330AA, 0xE07B2A37, 0x460C2183, 0x83AB1F0D, 0x25DC14B9, 0x14340E24, 0xB2430590,
+        0x23D5E9B7, 0x85A2E203, 0xB44AF89E, 0x123DF32A, 0xD79ACDA4, 0x71EDC610, 0x4005DC8D, 0xE672D739,
+        0x103AA7D0, 0xB64DAC64, 0x87A5B6F9, 0x21D2BD4D, 0xE47583C3, 0x42028877, 0x73EA92EA, 0xD59D995E,
+        0x8BB64CE5, 0x2DC14751, 0x1C295DCC, 0xBA5E5678, 0x7FF968F6, 0xD98E6342, 0xE86679DF, 0x4E11726B,
+        0xB8590282, 0x1E2E0936, 0x2FC613AB, 0x89B1181F, 0x4C162691, 0xEA612D25, 0xDB8937B8, 0x7DFE3C0C,
+        0xEC68D02B, 0x4A1FDB9F, 0x7BF7C102, 0xDD80CAB6, 0x1827F438, 0xBE50FF8C, 0x8FB8E511, 0x29CFEEA5,
+        0xDF879E4C, 0x79F095F8, 0x48188F65, 0xEE6F84D1, 0x2BC8BA5F, 0x8DBFB1EB, 0xBC57AB76, 0x1A20A0C2,
+        0x8816EAF2, 0x2E61E146, 0x1F89FBDB, 0xB9FEF06F, 0x7C59CEE1, 0xDA2EC555, 0xEBC6DFC8, 0x4DB1D47C,
+        0xBBF9A495, 0x1D8EAF21, 0x2C66B5BC, 0x8A11BE08, 0x4FB68086, 0xE9C18B32, 0xD82991AF, 0x7E5E9A1B,
+        0xEFC8763C, 0x49BF7D88, 0x78576715, 0xDE206CA1, 0x1B87522F, 0xBDF0599B, 0x8C184306, 0x2A6F48B2,
+        0xDC27385B, 0x7A5033EF, 0x4BB82972, 0xEDCF22C6, 0x28681C48, 0x8E1F17FC, 0xBFF70D61, 0x198006D5,
+        0x47ABD36E, 0xE1DCD8DA, 0xD034C247, 0x7643C9F3, 0xB3E4F77D, 0x1593FCC9, 0x247BE654, 0x820CEDE0,
+        0x74449D09, 0xD23396BD, 0xE3DB8C20, 0x45AC8794, 0x800BB91A, 0x267CB2AE, 0x1794A833, 0xB1E3A387,
+        0x20754FA0, 0x86024414, 0xB7EA5E89, 0x119D553D, 0xD43A6BB3, 0x724D6007, 0x43A57A9A, 0xE5D2712E,
+        0x139A01C7, 0xB5ED0A73, 0x840510EE, 0x22721B5A, 0xE7D525D4, 0x41A22E60, 0x704A34FD, 0xD63D3F49,
+        0xCC1D9F8B, 0x6A6A943F, 0x5B828EA2, 0xFDF58516, 0x3852BB98, 0x9E25B02C, 0xAFCDAAB1, 0x09BAA105,
+        0xFFF2D1EC, 0x5985DA58, 0x686DC0C5, 0xCE1ACB71, 0x0BBDF5FF, 0xADCAFE4B, 0x9C22E4D6, 0x3A55EF62,
+        0xABC30345, 0x0DB408F1, 0x3C5C126C, 0x9A2B19D8, 0x5F8C2756, 0xF9FB2CE2, 0xC813367F, 0x6E643DCB,
+        0x982C4D22, 0x3E5B4696, 0x0FB35C0B, 0xA9C457BF, 0x6C636931, 0xCA146285, 0xFBFC7818, 0x5D8B73AC,
+        0x03A0A617, 0xA5D7ADA3, 0x943FB73E, 0x3248BC8A, 0xF7EF8204, 0x519889B0, 0x6070932D, 0xC6079899,
+        0x304FE870, 0x9638E3C4, 0xA7D0F959, 0x01A7F2ED, 0xC400CC63, 0x6277C7D7, 0x539FDD4A, 0xF5E8D6FE,
+        0x647E3AD9, 0xC209316D, 0xF3E12BF0, 0x55962044, 0x90311ECA, 0x3646157E, 0x07AE0FE3, 0xA1D90457,
+        0x579174BE, 0xF1E67F0A, 0xC00E6597, 0x66796E23, 0xA3DE50AD, 0x05A95B19, 0x34414184, 0x92364A30
+    },
+    {
+        0x00000000, 0xCCAA009E, 0x4225077D, 0x8E8F07E3, 0x844A0EFA, 0x48E00E64, 0xC66F0987, 0x0AC50919,
+        0xD3E51BB5, 0x1F4F1B2B, 0x91C01CC8, 0x5D6A1C56, 0x57AF154F, 0x9B0515D1, 0x158A1232, 0xD92012AC,
+        0x7CBB312B, 0xB01131B5, 0x3E9E3656, 0xF23436C8, 0xF8F13FD1, 0x345B3F4F, 0xBAD438AC, 0x767E3832,
+        0xAF5E2A9E, 0x63F42A00, 0xED7B2DE3, 0x21D12D7D, 0x2B142464, 0xE7BE24FA, 0x69312319, 0xA59B2387,
+        0xF9766256, 0x35DC62C8, 0xBB53652B, 0x77F965B5, 0x7D3C6CAC, 0xB1966C32, 0x3F196BD1, 0xF3B36B4F,
+        0x2A9379E3, 0xE639797D, 0x68B67E9E, 0xA41C7E00, 0xAED97719, 0x62737787, 0xECFC7064, 0x205670FA,
+        0x85CD537D, 0x496753E3, 0xC7E85400, 0x0B42549E, 0x01875D87, 0xCD2D5D19, 0x43A25AFA, 0x8F085A64,
+        0x562848C8, 0x9A824856, 0x140D4FB5, 0xD8A74F2B, 0xD2624632, 0x1EC846AC, 0x9047414F, 0x5CED41D1,
+        0x299DC2ED, 0xE537C273, 0x6BB8C590, 0xA712C50E, 0xADD7CC17, 0x617DCC89, 0xEFF2CB6A, 0x2358CBF4,
+        0xFA78D958, 0x36D2D9C6, 0xB85DDE25, 0x74F7DEBB, 0x7E32D7A2, 0xB298D73C, 0x3C17D0DF, 0xF0BDD041,
+        0x5526F3C6, 0x998CF358, 0x1703F4BB, 0xDBA9F425, 0xD16CFD3C, 0x1DC6FDA2, 0x9349FA41, 0x5FE3FADF,
+        0x86C3E873, 0x4A69E8ED, 0xC4E6EF0E, 0x084CEF90, 0x0289E689, 0xCE23E617, 0x40ACE1F4, 0x8C06E16A,
+        0xD0EBA0BB, 0x1C41A025, 0x92CEA7C6, 0x5E64A758, 0x54A1AE41, 0x980BAEDF, 0x1684A93C, 0xDA2EA9A2,
+        0x030EBB0E, 0xCFA4BB90, 0x412BBC73, 0x8D81BCED, 0x8744B5F4, 0x4BEEB56A, 0xC561B289, 0x09CBB217,
+        0xAC509190, 0x60FA910E, 0xEE7596ED, 0x22DF9673, 0x281A9F6A, 0xE4B09FF4, 0x6A3F9817, 0xA6959889,
+        0x7FB58A25, 0xB31F8ABB, 0x3D908D58, 0xF13A8DC6, 0xFBFF84DF, 0x37558441, 0xB9DA83A2, 0x7570833C,
+        0x533B85DA, 0x9F918544, 0x111E82A7, 0xDDB48239, 0xD7718B20, 0x1BDB8BBE, 0x95548C5D, 0x59FE8CC3,
+        0x80DE9E6F, 0x4C749EF1, 0xC2FB9912, 0x0E51998C, 0x04949095, 0xC83E900B, 0x46B197E8, 0x8A1B9776,
+        0x2F80B4F1, 0xE32AB46F, 0x6DA5B38C, 0xA10FB312, 0xABCABA0B, 0x6760BA95, 0xE9EFBD76, 0x2545BDE8,
+        0xFC65AF44, 0x30CFAFDA, 0xBE40A839, 0x72EAA8A7, 0x782FA1BE, 0xB485A120, 0x3A0AA6C3, 0xF6A0A65D,
+        0xAA4DE78C, 0x66E7E712, 0xE868E0F1, 0x24C2E06F, 0x2E07E976, 0xE2ADE9E8, 0x6C22EE0B, 0xA088EE95,
+        0x79A8FC39, 0xB502FCA7, 0x3B8DFB44, 0xF727FBDA, 0xFDE2F2C3, 0x3148F25D, 0xBFC7F5BE, 0x736DF520,
+        0xD6F6D6A7, 0x1A5CD639, 0x94D3D1DA, 0x5879D144, 0x52BCD85D, 0x9E16D8C3, 0x1099DF20, 0xDC33DFBE,
+        0x0513CD12, 0xC9B9CD8C, 0x4736CA6F, 0x8B9CCAF1, 0x8159C3E8, 0x4DF3C376, 0xC37CC495, 0x0FD6C40B,
+        0x7AA64737, 0xB60C47A9, 0x3883404A, 0xF42940D4, 0xFEEC49CD, 0x32464953, 0xBCC94EB0, 0x70634E2E,
+        0xA9435C82, 0x65E95C1C, 0xEB665BFF, 0x27CC5B61, 0x2D095278, 0xE1A352E6, 0x6F2C5505, 0xA386559B,
+        0x061D761C, 0xCAB77682, 0x44387161, 0x889271FF, 0x825778E6, 0x4EFD7878, 0xC0727F9B, 0x0CD87F05,
+        0xD5F86DA9, 0x19526D37, 0x97DD6AD4, 0x5B776A4A, 0x51B26353, 0x9D1863CD, 0x1397642E, 0xDF3D64B0,
+        0x83D02561, 0x4F7A25FF, 0xC1F5221C, 0x0D5F2282, 0x079A2B9B, 0xCB302B05, 0x45BF2CE6, 0x89152C78,
+        0x50353ED4, 0x9C9F3E4A, 0x121039A9, 0xDEBA3937, 0xD47F302E, 0x18D530B0, 0x965A3753, 0x5AF037CD,
+        0xFF6B144A, 0x33C114D4, 0xBD4E1337, 0x71E413A9, 0x7B211AB0, 0xB78B1A2E, 0x39041DCD, 0xF5AE1D53,
+        0x2C8E0FFF, 0xE0240F61, 0x6EAB0882, 0xA201081C, 0xA8C40105, 0x646E019B, 0xEAE10678, 0x264B06E6
+    }
+};
+
+// Update CRC32 with buffer data
+// NOTE: Provided crc is not inverted, start with ~0u and invert result
+static unsigned int update_crc32(unsigned int crc, const unsigned char *buffer, int size)
+{
+#if defined(RPNG_SIMD_CLMUL)
+    // Carry-less multiplication folding for big buffers, 16 bytes blocks, if CPU supports it
+    if ((size >= 64) && rpng_cpu_has_clmul())
+    {
+        int size_clmul = size & ~15;
+        crc = update_crc32_clmul(crc, buffer, size_clmul);
+        buffer += size_clmul;
+        size -= size_clmul;
+    }
+#endif
 
-    unsigned int crc = ~0u;
+    // Slicing-by-8: 8 bytes processed per iteration with 8 independent table lookups
+    while (size >= 8)
+    {
+        unsigned int lo = crc ^ ((unsigned int)buffer[0] | ((unsigned int)buffer[1] << 8) | ((unsigned int)buffer[2] << 16) | ((unsigned int)buffer[3] << 24));
+        unsigned int hi = (unsigned int)buffer[4] | ((unsigned int)buffer[5] << 8) | ((unsigned int)buffer[6] << 16) | ((unsigned int)buffer[7] << 24);
 
-    for (int i = 0; i < size; i++) crc = (crc >> 8) ^ crc_table[buffer[i] ^ (crc & 0xff)];
+        crc = crc32_tables[7][lo & 0xff] ^ crc32_tables[6][(lo >> 8) & 0xff] ^ crc32_tables[5][(lo >> 16) & 0xff] ^ crc32_tables[4][lo >> 24] ^
+              crc32_tables[3][hi & 0xff] ^ crc32_tables[2][(hi >> 8) & 0xff] ^ crc32_tables[1][(hi >> 16) & 0xff] ^ crc32_tables[0][hi >> 24];
 
-    return ~crc;
+        buffer += 8;
+        size -= 8;
+    }
+
+    for (int i = 0; i < size; i++) crc = (crc >> 8) ^ crc32_tables[0][buffer[i] ^ (crc & 0xff)];
+
+    return crc;
+}
+
+#if defined(RPNG_SIMD_CLMUL)
+// Check CPU support for carry-less multiplication (PCLMULQDQ)
+// NOTE: Checked once, in case of multiple threads checking at the same time, same value is written
+static bool rpng_cpu_has_clmul(void)
+{
+    static int has_clmul = -1;
+
+    if (has_clmul == -1)
+    {
+    #if defined(_MSC_VER)
+        int info[4] = { 0 };
+        __cpuid(info, 1);
+        has_clmul = (info[2] >> 1) & 1;     // CPUID.01H:ECX.PCLMULQDQ[bit 1]
+    #else
+        unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+        has_clmul = (__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_PCLMUL))? 1 : 0;
+    #endif
+    }
+
+    return (has_clmul == 1);
+}
+
+// Update CRC32 with buffer data using carry-less multiplication folding, size must be a multiple of 16 (>= 64)
+// NOTE: 4x128 bit lanes folded in parallel, then folded into 128 bit and Barrett reduced to 32 bit
+// REF: Intel, Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction (constants for reflected CRC32)
+RPNG_TARGET_CLMUL static unsigned int update_crc32_clmul(unsigned int crc, const unsigned char *buffer, int size)
+{
+    const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+    const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+    const __m128i k5k0 = _mm_set_epi64x(0x0000000000, 0x0163cd6124);
+    const __m128i poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+    const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+
+    __m128i x1 = _mm_loadu_si128((const __m128i *)(buffer + 0x00));
+    __m128i x2 = _mm_loadu_si128((const __m128i *)(buffer + 0x10));
+    __m128i x3 = _mm_loadu_si128((const __m128i *)(buffer + 0x20));
+    __m128i x4 = _mm_loadu_si128((const __m128i *)(buffer + 0x30));
+    __m128i x5;
+
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+    buffer += 64;
+    size -= 64;
+
+    // Fold 64 bytes blocks, 4 lanes
+    while (size >= 64)
+    {
+        __m128i y1 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+        __m128i y2 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+        __m128i y3 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+        __m128i y4 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+
+        x1 = _mm_xor_si128(_mm_clmulepi64_si128(x1, k1k2, 0x11), y1);
+        x2 = _mm_xor_si128(_mm_clmulepi64_si128(x2, k1k2, 0x11), y2);
+        x3 = _mm_xor_si128(_mm_clmulepi64_si128(x3, k1k2, 0x11), y3);
+        x4 = _mm_xor_si128(_mm_clmulepi64_si128(x4, k1k2, 0x11), y4);
+
+        x1 = _mm_xor_si128(x1, _mm_loadu_si128((const __m128i *)(buffer + 0x00)));
+        x2 = _mm_xor_si128(x2, _mm_loadu_si128((const __m128i *)(buffer + 0x10)));
+        x3 = _mm_xor_si128(x3, _mm_loadu_si128((const __m128i *)(buffer + 0x20)));
+        x4 = _mm_xor_si128(x4, _mm_loadu_si128((const __m128i *)(buffer + 0x30)));
+
+        buffer += 64;
+        size -= 64;
+    }
+
+    // Fold 4 lanes into 1 lane (128 bit)
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), x2), x5);
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), x3), x5);
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), x4), x5);
+
+    // Fold remaining 16 bytes blocks
+    while (size >= 16)
+    {
+        x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+        x1 = _mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), _mm_loadu_si128((const __m128i *)buffer));
+        x1 = _mm_xor_si128(x1, x5);
+
+        buffer += 16;
+        size -= 16;
+    }
+
+    // Fold 128 bit into 64 bit
+    x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, mask32);
+    x1 = _mm_xor_si128(_mm_clmulepi64_si128(x1, k5k0, 0x00), x2);
+
+    // Barrett reduction to 32 bit
+    x2 = _mm_and_si128(x1, mask32);
+    x2 = _mm_clmulepi64_si128(x2, poly, 0x10);
+    x2 = _mm_and_si128(x2, mask32);
+    x2 = _mm_clmulepi64_si128(x2, poly, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return (unsigned int)_mm_cvtsi128_si32(_mm_srli_si128(x1, 4));
+}
+#endif
+
+#if defined(RPNG_THREADS)
+// Multiply two polynomials modulo CRC32 polynomial (reflected bit order)
+static unsigned int crc32_multmodp(unsigned int a, unsigned int b)
+{
+    unsigned int m = 1u << 31;
+    unsigned int p = 0;
+
+    while (m != 0)
+    {
+        if (a & m)
+        {
+            p ^= b;
+            if ((a & (m - 1)) == 0) break;
+        }
+
+        m >>= 1;
+        b = (b & 1)? ((b >> 1) ^ 0xEDB88320) : (b >> 1);
+    }
+
+    return p;
+}
+
+// Combine CRC32 of two consecutive data blocks, second block size required
+// NOTE: crc1 is shifted over size2 zero bytes multiplying by x^(8*size2) mod p, computed by squaring
+// REF: zlib crc32_combine()
+static unsigned int crc32_combine(unsigned int crc1, unsigned int crc2, int size2)
+{
+    unsigned int xn = 1u << 31;         // x^0
+    unsigned int x8 = 1u << 23;         // x^8, one zero byte
+
+    for (unsigned int n = (unsigned int)size2; n > 0; n >>= 1)
+    {
+        if (n & 1) xn = crc32_multmodp(x8, xn);
+        x8 = crc32_multmodp(x8, x8);
+    }
+
+    return crc32_multmodp(xn, crc1) ^ crc2;
+}
+#endif
+
+// Get PNG buffer size (signature + chunks, up to IEND)
+static int get_buffer_size(const char *buffer)
+{
+    const char *buffer_ptr = buffer + 8;    // Move pointer after signature
+    unsigned int chunk_size = 0;
+
+    while (memcmp(buffer_ptr + 4, "IEND", 4) != 0) // While IEND chunk not reached
+    {
+        memcpy(&chunk_size, buffer_ptr, 4);
+        buffer_ptr += (4 + 4 + swap_endian(chunk_size) + 4);    // Skip chunk Length + FOURCC + chunk data + CRC32
+    }
+
+    return (int)(buffer_ptr - buffer) + 12;   // Include IEND chunk
 }
 
 // Load data from file into a buffer
@@ -2362,7 +4001,9 @@ static bool file_exists(const char *filename)
     return result;
 }
 
-#if defined(RPNG_DEFLATE_IMPLEMENTATION)
+// NOTE: sdefl internal functions are also required by threaded compression (RPNG_THREADS),
+// sdefl/sinfl external functions are only defined with RPNG_DEFLATE_IMPLEMENTATION
+#if defined(RPNG_DEFLATE_IMPLEMENTATION) || defined(RPNG_THREADS)
 
 //=========================================================================
 //                              SDEFL
@@ -2853,16 +4494,27 @@ sdefl_fnd(struct sdefl_match *m, const struct sdefl *s, int chain_len,
     i = s->prv[i & SDEFL_WIN_MSK];
   }
 }
+/* rpng: compresses in[in_begin..in_len), previous 32KB used as dictionary,
+ * not last ranges end with a sync flush: last byte in a stored block, so output
+ * is byte aligned and not final (empty stored blocks are not supported by sinfl) */
 static int
 sdefl_compr(struct sdefl *s, unsigned char *out, const unsigned char *in,
-            int in_len, int lvl) {
+            int in_begin, int in_len, int lvl, int is_last) {
   unsigned char *q = out;
   static const unsigned char pref[] = {8,10,14,24,30,48,65,96,130};
   int max_chain = (lvl < 8) ? (1 << (lvl + 1)): (1 << 13);
-  int n, i = 0, litlen = 0;
+  int n, i = in_begin, litlen = 0;
+  if (!is_last) {
+    in_len--;
+  }
   for (n = 0; n < SDEFL_HASH_SIZ; ++n) {
     s->tbl[n] = SDEFL_NIL;
   }
+  for (n = (in_begin > SDEFL_WIN_SIZ) ? (in_begin - SDEFL_WIN_SIZ) : 0; n < in_begin; ++n) {
+    unsigned h = sdefl_hash32(&in[n]);
+    s->prv[n&SDEFL_WIN_MSK] = s->tbl[h];
+    s->tbl[h] = n;
+  }
   do {int blk_begin = i;
     int blk_end = ((i + SDEFL_BLK_MAX) < in_len) ? (i + SDEFL_BLK_MAX) : in_len;
     while (i < blk_end) {
@@ -2912,19 +4564,30 @@ sdefl_compr(struct sdefl *s, unsigned char *out, const unsigned char *in,
       sdefl_seq(s, i - litlen, litlen);
       litlen = 0;
     }
-    sdefl_flush(&q, s, blk_end == in_len, in, blk_begin, blk_end);
+    sdefl_flush(&q, s, is_last && (blk_end == in_len), in, blk_begin, blk_end);
   } while (i < in_len);
+  if (!is_last) {
+    sdefl_put(&q, s, 0x00, 1); /* block */
+    sdefl_put(&q, s, 0x00, 2); /* stored block */
+  }
   if (s->bitcnt) {
     sdefl_put(&q, s, 0x00, 8 - s->bitcnt);
   }
   assert(s->bitcnt == 0);
+  if (!is_last) {
+    sdefl_put16(&q, 0x0001);
+    sdefl_put16(&q, 0xFFFE);
+    *q++ = in[in_len];
+  }
   return (int)(q - out);
 }
+#if defined(RPNG_DEFLATE_IMPLEMENTATION)
 extern int
 sdeflate(struct sdefl *s, void *out, const void *in, int n, int lvl) {
   s->bits = s->bitcnt = 0;
-  return sdefl_compr(s, (unsigned char*)out, (const unsigned char*)in, n, lvl);
+  return sdefl_compr(s, (unsigned char*)out, (const unsigned char*)in, 0, n, lvl, 1);
 }
+#endif
 static unsigned
 sdefl_adler32(unsigned adler32, const unsigned char *in, int in_len) {
   #define SDEFL_ADLER_INIT (1)
@@ -2956,6 +4619,7 @@ sdefl_adler32(unsigned adler32, const unsigned char *in, int in_len) {
   }
   return (unsigned)(s2 << 16) + (unsigned)s1;
 }
+#if defined(RPNG_DEFLATE_IMPLEMENTATION)
 extern int
 zsdeflate(struct sdefl *s, void *out, const void *in, int n, int lvl) {
   int p = 0;
@@ -2965,7 +4629,7 @@ zsdeflate(struct sdefl *s, void *out, const void *in, int n, int lvl) {
   s->bits = s->bitcnt = 0;
   sdefl_put(&q, s, 0x78, 8); /* deflate, 32k window */
   sdefl_put(&q, s, 0x01, 8); /* fast compression */
-  q += sdefl_compr(s, q, (const unsigned char*)in, n, lvl);
+  q += sdefl_compr(s, q, (const unsigned char*)in, 0, n, lvl, 1);
 
   /* append adler checksum */
   a = sdefl_adler32(SDEFL_ADLER_INIT, (const unsigned char*)in, n);
@@ -2981,8 +4645,13 @@ sdefl_bound(int len) {
   int bound = 5 * max_blocks + len + 1 + 4 + 8;
   return bound;
 }
+#endif /* RPNG_DEFLATE_IMPLEMENTATION */
 #endif /* SDEFL_IMPLEMENTATION */
 
+#endif  // RPNG_DEFLATE_IMPLEMENTATION || RPNG_THREADS
+
+// NOTE: sinfl internal functions are always included, required by image data streaming (output flush)
+
 
 //=========================================================================
 //                           SINFL
@@ -3041,11 +4710,13 @@ sinfl_copy64(unsigned char **dst, unsigned char **src) {
   memcpy(*dst, &n, 8);
   *dst += 8, *src += 8;
 }
+#ifdef SINFL_NO_SIMD
 static unsigned char*
 sinfl_write64(unsigned char *dst, unsigned long long w) {
   memcpy(dst, &w, 8);
   return dst + 8;
 }
+#endif
 #ifndef SINFL_NO_SIMD
 static unsigned char*
 sinfl_write128(unsigned char *dst, sinfl_char16 w) {
@@ -3066,6 +4737,11 @@ sinfl_refill(struct sinfl *s) {
   s->bitcnt |= 56; /* bitcount in range [56,63] */
 }
 static int
+sinfl_overrun(const struct sinfl *s, const unsigned char *e) {
+  /* rpng: bytes loaded but not consumed are not counted, input reads stay under e + 16 */
+  return (s->bitptr - (s->bitcnt >> 3)) > e;
+}
+static int
 sinfl_peek(struct sinfl *s, int cnt) {
   assert(cnt >= 0 && cnt <= 56);
   assert(cnt <= s->bitcnt);
@@ -3216,7 +4892,8 @@ sinfl_decode(struct sinfl *s, const unsigned *tbl, int bit_len) {
   return (key >> 16) & 0x0fff;
 }
 static int
-sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size) {
+sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size,
+                 sinfl_flush_func flush, void *user) {
   static const unsigned char order[] = {16,17,18,0,8,7,9,6,10,5,11,4,12,3,13,2,14,1,15};
   static const short dbase[30+2] = {1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193,
       257,385,513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577};
@@ -3260,11 +4937,23 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
 
       if ((unsigned short)len != (unsigned short)~nlen)
         return (int)(out-o);
-      if (len > (e - s.bitptr) || !len)
-        return (int)(out-o);
-
-      memcpy(out, s.bitptr, (size_t)len);
-      s.bitptr += len, out += len;
+      if (len > (e - s.bitptr))
+        return (int)(out-o); /* rpng: empty stored blocks supported (sync flush) */
+      if (!flush && len > (unsigned)(oe - out))
+        return (int)(out-o); /* rpng: block must fit into output capacity */
+
+      while (len > 0) {
+        /* rpng: block copied in pieces on output flush */
+        unsigned n = len;
+        if (flush && (oe - out) < SINFL_FLUSH_MARGIN) {
+          out = flush(user, out);
+          if (!out) return -1;
+        }
+        if (n > (unsigned)(oe - out)) n = (unsigned)(oe - out);
+        if (!n) return (int)(out-o);
+        memcpy(out, s.bitptr, (size_t)n);
+        s.bitptr += n, out += n, len -= n;
+      }
       if (last) return (int)(out-o);
       state = hdr;
     } break;
@@ -3299,12 +4988,23 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
       /* decode code lengths */
       for (n = 0; n < nlit + ndist;) {
         int sym = 0;
+        if (sinfl_unlikely(sinfl_overrun(&s, e))) {
+          /* rpng: input data consumed, stream truncated or corrupted */
+          return (int)(out-o);
+        }
         sinfl_refill(&s);
         sym = sinfl_decode(&s, hlens, 7);
         switch (sym) {default: lens[n++] = (unsigned char)sym; break;
-        case 16: for (i=3+sinfl_get(&s,2);i;i--,n++) lens[n]=lens[n-1]; break;
-        case 17: for (i=3+sinfl_get(&s,3);i;i--,n++) lens[n]=0; break;
-        case 18: for (i=11+sinfl_get(&s,7);i;i--,n++) lens[n]=0; break;}
+        case 16: i = 3+sinfl_get(&s,2); break;
+        case 17: i = 3+sinfl_get(&s,3); break;
+        case 18: i = 11+sinfl_get(&s,7); break;}
+        if (sym >= 16) {
+          /* rpng: repeats must fit into code lengths, no previous length to repeat on first one */
+          if (sinfl_unlikely((n + i > nlit + ndist) || ((sym == 16) && (n == 0)))) {
+            return (int)(out-o);
+          }
+          for (;i;i--,n++) lens[n] = (sym == 16)? lens[n-1] : 0;
+        }
       }
       /* build lit/dist tables */
       sinfl_build(s.lits, lens, 10, 15, nlit);
@@ -3315,6 +5015,15 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
       /* decompress block */
       while (1) {
         int sym;
+        if (flush && (oe - out) < SINFL_FLUSH_MARGIN) {
+          /* rpng: output flush, space for two literals or one match always available */
+          out = flush(user, out);
+          if (!out) return -1;
+        }
+        if (sinfl_unlikely(sinfl_overrun(&s, e))) {
+          /* rpng: input data consumed, stream truncated or corrupted */
+          return (int)(out-o);
+        }
         sinfl_refill(&s);
         sym = sinfl_decode(&s, s.lits, 10);
         if (sym < 256) {
@@ -3325,6 +5034,10 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
           *out++ = (unsigned char)sym;
           sym = sinfl_decode(&s, s.lits, 10);
           if (sym < 256) {
+            if (sinfl_unlikely(out >= oe)) {
+              /* rpng: literal must fit into output capacity */
+              return (int)(out-o);
+            }
             *out++ = (unsigned char)sym;
             continue;
           }
@@ -3348,6 +5061,10 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
         if (sinfl_unlikely(offs > (int)(out-o))) {
           return (int)(out-o);
         }
+        if (sinfl_unlikely(len > (int)(oe-out))) {
+          /* rpng: match must fit into output capacity */
+          return (int)(out-o);
+        }
         out = out + len;
 
 #ifndef SINFL_NO_SIMD
@@ -3416,10 +5133,12 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
   }
   return (int)(out-o);
 }
+#if defined(RPNG_DEFLATE_IMPLEMENTATION)
 extern int
 sinflate(void *out, int cap, const void *in, int size) {
-  return sinfl_decompress((unsigned char*)out, cap, (const unsigned char*)in, size);
+  return sinfl_decompress((unsigned char*)out, cap, (const unsigned char*)in, size, 0, 0);
 }
+#endif /* RPNG_DEFLATE_IMPLEMENTATION */
 static unsigned
 sinfl_adler32(unsigned adler32, const unsigned char *in, int in_len) {
   const unsigned ADLER_MOD = 65521;
@@ -3447,12 +5166,14 @@ sinfl_adler32(unsigned adler32, const unsigned char *in, int in_len) {
     blk_len = 5552;
   } return (unsigned)(s2 << 16) + (unsigned)s1;
 }
+#if defined(RPNG_DEFLATE_IMPLEMENTATION)
 extern int
 zsinflate(void *out, int cap, const void *mem, int size) {
   const unsigned char *in = (const unsigned char*)mem;
   if (size >= 6) {
     const unsigned char *eob = in + size - 4;
-    int n = sinfl_decompress((unsigned char*)out, cap, in + 2u, size);
+    /* rpng: input size excludes zlib header (2 bytes), input end is checked on decompression */
+    int n = sinfl_decompress((unsigned char*)out, cap, in + 2u, size - 2, 0, 0);
     unsigned a = sinfl_adler32(1u, (unsigned char*)out, n);
     unsigned h = eob[0] << 24 | eob[1] << 16 | eob[2] << 8 | eob[3] << 0;
     return a == h ? n : -1;
@@ -3460,6 +5181,7 @@ zsinflate(void *out, int cap, const void *mem, int size) {
     return -1;
   }
 }
+#endif /* RPNG_DEFLATE_IMPLEMENTATION */
 
 #endif  /* SINFL_IMPLEMENTATION */
 
@@ -3574,6 +5296,5 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 ------------------------------------------------------------------------------
 ```
 */
-#endif  // RPNG_DEFLATE_IMPLEMENTATION
 
 #endif  // RPNG_IMPLEMENTATION
@@ -123,6 +123,9 @@ static const char *helpLines[] = {
     "LCTRL + Z,Y - Undo/Redo icon edition",
     "LCTRL + UP,DOWN - Move icon Up,Down",
     "LCTRL + LEFT,RIGHT - Move icon Left,Right",
+    "LCTRL + R - Rotate icon 90 (+LSHIFT: -90, +LALT: 180)",
+    "LCTRL + I - Invert icon pixels",
+    "LSHIFT + ARROWS - Shift icon pixels",
     "DEL - Clean current selected icon",
     "-Tool Visuals",
     "LCTRL + F - Toggle double screen size",
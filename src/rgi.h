@@ -0,0 +1,2368 @@
+/**********************************************************************************************
+*
+*   rgi v1.0 - A simple and easy-to-use library to manage raygui icons sets (.rgi)
+*
+*   FEATURES:
+*       - Load/Save raygui iconset files (.rgi), from/to file or memory buffer
+*       - Files saved atomically: data written to a temporary file and renamed into place
+*       - Map iconset files (.rgi) into memory, validated and zero-copy icons data and names access
+*       - Export iconset as an embeddable code file (.h): C array, C++17 constexpr or compressed blob layouts
+*       - C++17 code export with compile time icons name ids lookup (perfect hash)
+*       - Generate iconset image data (grayscale, 8bit or packed 1bit) and load iconset from image data
+*       - Load iconset from image rows, one by one (streamed image decoding)
+*       - Iconset trimming to icons used by sources (ICON_<name> ids, "#NNN#" markers), remap table export
+*       - Iconset atlas generation, icons pre-rasterized at several scales, rectangles and UVs code export
+*       - Icon data access: zero-copy icon view, rows and pixels get/set
+*       - Icons transforms on icons ranges: flip, rotate, shift, invert
+*       - No window or graphics dependency, iconsets managed with an explicit handle
+*
+*   LIMITATIONS:
+*       - Limited to 16x16 pixels 1bpp icons
+*
+*   CONFIGURATION:
+*       #define RGI_IMPLEMENTATION
+*           Generates the implementation of the library into the included file.
+*           If not defined, the library is in header only mode and can be included in other headers
+*           or source files without problems. But only ONE file should hold the implementation.
+*
+*       #define RGI_NO_STDIO
+*           Do not include FILE I/O API, only load/save from/to memory buffers
+*
+*       #define RGI_NO_MMAP
+*           Do not use memory mapped files, iconset files mapping reads the full file into memory
+*           NOTE: On Windows, required Win32 functions are declared by rgi (avoiding windows.h conflicts),
+*           declarations are compatible with windows.h ones, it can be included before or after rgi
+*
+*       #define RGI_NO_SIMD
+*           Do not use SIMD (SSE2) intrinsics for icons transforms, even if available
+*
+*   DEPENDENCIES: libc (C standard library)
+*       stdlib.h        Required for: malloc(), calloc(), free()
+*       string.h        Required for: memcpy(), memset(), memcmp(), strlen()
+*       stdio.h         Required for: FILE, fopen(), fread(), fwrite(), fprintf(), fclose() (only if !RGI_NO_STDIO)
+*       sys/mman.h      Required for: mmap(), munmap() (only if !RGI_NO_STDIO and !RGI_NO_MMAP, not Windows)
+*       emmintrin.h     Required for: SSE2 intrinsics (only if available and !RGI_NO_SIMD)
+*
+*   BUILDING:
+*       rgi can be built as a static library for headless usage (no raylib required), i.e:
+*
+*           gcc -c -x c rgi.h -DRGI_IMPLEMENTATION -o rgi.o
+*           ar rcs librgi.a rgi.o
+*
+*   VERSIONS HISTORY:
+*       1.0 (xx-Jun-2026) First version of the library, extracted from rGuiIcons tool
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2019-2026 raylib technologies (@raylibtech) / Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef RGI_H
+#define RGI_H
+
+#define RGI_VERSION    "1.0"
+
+// Function specifiers in case library is build/used as a shared library (Windows)
+// NOTE: Microsoft specifiers to tell compiler that symbols are imported/exported from a .dll
+#if defined(_WIN32)
+    #if defined(BUILD_LIBTYPE_SHARED)
+        #define RGIAPI __declspec(dllexport)     // We are building the library as a Win32 shared library (.dll)
+    #elif defined(USE_LIBTYPE_SHARED)
+        #define RGIAPI __declspec(dllimport)     // We are using the library as a Win32 shared library (.dll)
+    #endif
+#endif
+
+// Function specifiers definition
+#ifndef RGIAPI
+    #define RGIAPI       // Functions defined as 'extern' by default (implicit specifiers)
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+// Allow custom memory allocators
+#ifndef RGI_MALLOC
+    #define RGI_MALLOC(sz)          malloc(sz)
+#endif
+#ifndef RGI_CALLOC
+    #define RGI_CALLOC(n,sz)        calloc(n,sz)
+#endif
+#ifndef RGI_REALLOC
+    #define RGI_REALLOC(ptr,sz)     realloc(ptr,sz)
+#endif
+#ifndef RGI_FREE
+    #define RGI_FREE(ptr)           free(ptr)
+#endif
+
+// Simple log system to avoid RGI_LOG() calls if required
+// NOTE: Avoiding those calls, also avoids const strings memory usage
+//#define RGI_SHOW_LOG_INFO
+#if defined(RGI_SHOW_LOG_INFO)
+  #define RGI_LOG(...) printf(__VA_ARGS__)
+#else
+  #define RGI_LOG(...)
+#endif
+
+#define RGI_ICON_SIZE               16      // Size of icons in pixels (squared)
+#define RGI_ICON_MAX_NAME_LENGTH    32      // Maximum length of icon name id
+
+// Icons data is defined by bit array (every bit represents one pixel)
+// Those arrays are stored as unsigned int data arrays, so every array
+// element defines 32 pixels (bits) of information
+#define RGI_ICON_DATA_ELEMENTS      (RGI_ICON_SIZE*RGI_ICON_SIZE/32)
+
+// Define some possible error values
+#define RGI_SUCCESS                 0       // Iconset saved successfully
+#define RGI_ERROR_FILE_OPEN         1       // The requested file can not be opened
+#define RGI_ERROR_FILE_FORMAT       2       // Not a valid iconset file
+#define RGI_ERROR_MEMORY_ALLOC      3       // Memory could not be allocated for operation
+#define RGI_ERROR_FILE_WRITE        4       // The requested file could not be written or replaced
+
+// Code export formats (layouts)
+#define RGI_CODE_FORMAT_C           0       // C header: icons enum and data array (raygui compatible)
+#define RGI_CODE_FORMAT_CPP         1       // C++17 header: icons enum, constexpr data array (read-only) and name ids perfect hash lookup
+#define RGI_CODE_FORMAT_BLOB        2       // C header: icons enum and iconset file data compressed blob (PackBits)
+#define RGI_CODE_FORMAT_COUNT       3       // Number of code export formats
+
+// Iconset atlas limits
+#define RGI_ATLAS_MAX_SCALES        8       // Maximum number of icons scales on one atlas
+#define RGI_ATLAS_MAX_SCALE         8       // Maximum icons scale (icon pixel rasterized as scale*scale pixels)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+#ifndef __cplusplus
+#include <stdbool.h>        // Boolean type
+#endif
+
+// Iconset type
+// NOTE: Icon rows (16 pixels) are stored in 16 bits, first pixel on lower bit,
+// every data element contains two rows, first row on lower bits
+typedef struct {
+    int count;              // Number of icons
+    int size;               // Icons size in pixels (squared), only RGI_ICON_SIZE supported
+    unsigned int *values;   // Icons data, RGI_ICON_DATA_ELEMENTS per icon
+    char *names;            // Icons names, RGI_ICON_MAX_NAME_LENGTH per icon (can be NULL)
+} rgi_iconset;
+
+// Iconset file mapped into memory (read-only)
+// NOTE: Iconset values and names point directly into file data, no copy,
+// data must not be modified and it is only valid until file is unmapped
+typedef struct {
+    rgi_iconset iconset;    // Iconset view of file data
+    unsigned char *data;    // File data, mapped into memory
+    int size;               // File data size
+    void *mapping;          // File mapping handle (platform dependant)
+} rgi_iconset_file;
+
+#ifdef __cplusplus
+extern "C" {                // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+
+// Iconset management
+RGIAPI rgi_iconset rgi_gen_iconset(int count);                                                   // Generate an empty iconset (data and names allocated)
+RGIAPI void rgi_unload_iconset(rgi_iconset iconset);                                             // Unload iconset allocated data
+
+// Load/Save iconset from/to file or memory buffer
+// WARNING: Loaded iconset must be unloaded with rgi_unload_iconset()
+RGIAPI rgi_iconset rgi_load_iconset(const char *filename);                                       // Load iconset from file (.rgi)
+RGIAPI rgi_iconset rgi_load_iconset_from_memory(const unsigned char *buffer, int size);          // Load iconset from memory buffer (.rgi)
+RGIAPI int rgi_save_iconset(rgi_iconset iconset, const char *filename);                          // Save iconset to file (.rgi), atomic, returns 0-SUCCESS
+RGIAPI unsigned char *rgi_save_iconset_to_memory(rgi_iconset iconset, int *output_size);         // Save iconset to memory buffer (.rgi)
+RGIAPI int rgi_export_iconset_as_code(rgi_iconset iconset, const char *filename);                // Export iconset as code file (.h), C layout, returns 0-SUCCESS
+RGIAPI char *rgi_export_iconset_as_code_to_memory(rgi_iconset iconset, int format, int *output_size); // Export iconset as code to memory buffer (text), RGI_CODE_FORMAT_*
+
+// Map iconset file into memory, no data copy
+// NOTE: Header, icons count and size are validated against file size,
+// icons names must be NULL terminated, file.data is NULL if not valid
+RGIAPI rgi_iconset_file rgi_map_iconset(const char *filename);                                   // Map iconset file into memory (read-only, validated)
+RGIAPI void rgi_unmap_iconset(rgi_iconset_file file);                                            // Unmap iconset file from memory
+
+// Save data to file atomically, returns 0-SUCCESS
+// NOTE: Data is written to an exclusively created temporary file (<filename>.<pid>.<n>.tmp), flushed
+// to disk and renamed into place, a failure or crash while saving never leaves a truncated file at filename
+RGIAPI int rgi_save_file_data(const char *filename, const unsigned char *data, int size);
+
+// Iconset image data
+//  - Image data is 8bit grayscale: icon pixels set are WHITE (255), the rest BLACK (0)
+//  - Every icon is placed in a cell of (RGI_ICON_SIZE + 2*padding) pixels
+RGIAPI unsigned char *rgi_gen_image_data(rgi_iconset iconset, int icons_per_line, int padding, int *width, int *height); // Generate iconset image data
+RGIAPI unsigned char *rgi_gen_image_bits(rgi_iconset iconset, int icons_per_line, int padding, int *width, int *height); // Generate iconset image data, packed 1bit (PNG scanlines)
+RGIAPI rgi_iconset rgi_load_iconset_from_image_data(const unsigned char *data, int width, int height, int channels, int icon_count, int icons_per_line, int padding); // Load iconset from image data (1-4 channels, 8bit)
+RGIAPI rgi_iconset rgi_load_iconset_from_image_bits(const unsigned char *data, int width, int height, int icon_count, int icons_per_line, int padding); // Load iconset from image data, packed 1bit (PNG scanlines)
+RGIAPI void rgi_set_icons_from_image_row(rgi_iconset iconset, const unsigned char *row, int y, int width, int channels, int bit_depth, int icons_per_line, int padding); // Set icons rows from one image row (8bit or packed 1bit)
+
+// Iconset trimming, only icons used by sources are kept
+//  - Icons usage is found on sources text: ICON_<name> identifiers and "#NNN#" text markers
+//  - Trimmed iconset keeps icons original order, remap table: original id -> trimmed id (-1 if removed)
+RGIAPI int rgi_scan_icons_usage(rgi_iconset iconset, const char *text, int size, bool *used);   // Scan source text for icons usage, returns number of icons newly marked as used
+RGIAPI rgi_iconset rgi_gen_iconset_trimmed(rgi_iconset iconset, const bool *used, int *remap);  // Generate iconset with used icons only, remap filled for every original icon
+RGIAPI char *rgi_export_icons_remap_as_code_to_memory(rgi_iconset iconset, const int *remap, int *output_size); // Export icons remap table as code to memory buffer (text, C header)
+
+// Iconset atlas, icons pre-rasterized to be drawn as textured quads (one atlas texture for all icons)
+//  - Atlas data is 8bit single channel, icons coverage (alpha): pixels set 255, the rest 0
+//  - Icons rasterized at every requested scale (nearest), one atlas section per scale, stacked vertically
+//  - Every icon is placed in a cell of (RGI_ICON_SIZE*scale + 2*padding) pixels, padding avoids filtering bleeding
+RGIAPI unsigned char *rgi_gen_atlas_data(rgi_iconset iconset, const int *scales, int scale_count, int padding, int *width, int *height); // Generate iconset atlas data (8bit, single channel)
+RGIAPI char *rgi_export_atlas_as_code_to_memory(rgi_iconset iconset, const int *scales, int scale_count, int padding, int *output_size); // Export atlas icons rectangles and UVs as code to memory buffer (text, C header)
+
+// Icon data access
+RGIAPI const unsigned int *rgi_get_icon_view(rgi_iconset iconset, int id);                       // Get icon data view, pointer into iconset (no copy), NULL if not valid
+RGIAPI void rgi_set_icon_data(rgi_iconset iconset, int id, const unsigned int *data);            // Set icon data (RGI_ICON_DATA_ELEMENTS values)
+RGIAPI unsigned short rgi_get_icon_row(rgi_iconset iconset, int id, int row);                    // Get icon row bits (16 pixels)
+RGIAPI void rgi_set_icon_row(rgi_iconset iconset, int id, int row, unsigned short bits);         // Set icon row bits (16 pixels)
+RGIAPI void rgi_set_icon_pixel(rgi_iconset iconset, int id, int x, int y);                       // Set icon pixel
+RGIAPI void rgi_clear_icon_pixel(rgi_iconset iconset, int id, int x, int y);                     // Clear icon pixel
+RGIAPI bool rgi_check_icon_pixel(rgi_iconset iconset, int id, int x, int y);                     // Check icon pixel
+RGIAPI const char *rgi_get_icon_name(rgi_iconset iconset, int id);                               // Get icon name id, NULL if not available
+RGIAPI void rgi_set_icon_name(rgi_iconset iconset, int id, const char *name);                    // Set icon name id (up to RGI_ICON_MAX_NAME_LENGTH - 1 chars)
+
+// Icons transforms, applied to a range of icons
+RGIAPI void rgi_flip_icons_h(rgi_iconset iconset, int first, int count);                         // Flip icons horizontally
+RGIAPI void rgi_flip_icons_v(rgi_iconset iconset, int first, int count);                         // Flip icons vertically
+RGIAPI void rgi_rotate_icons(rgi_iconset iconset, int first, int count, int degrees);            // Rotate icons clockwise (90, 180, 270 degrees)
+RGIAPI void rgi_shift_icons(rgi_iconset iconset, int first, int count, int offset_x, int offset_y); // Shift icons pixels, cleared pixels filled with 0
+RGIAPI void rgi_invert_icons(rgi_iconset iconset, int first, int count);                         // Invert icons pixels
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RGI_H
+
+/***********************************************************************************
+*
+*   RGI IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(RGI_IMPLEMENTATION)
+
+#if !defined(RGI_NO_STDIO)
+    #include <stdio.h>      // Required for: FILE, fopen(), fread(), fwrite(), fprintf(), fclose()
+#endif
+
+#include <stdlib.h>         // Required for: malloc(), calloc(), free()
+#include <string.h>         // Required for: memcpy(), memset(), strlen()
+
+#if !defined(RGI_NO_STDIO)
+    #include <errno.h>          // Required for: errno, EEXIST
+    #include <fcntl.h>          // Required for: open(), O_CREAT, O_EXCL
+    #if defined(_WIN32)
+        #include <io.h>         // Required for: _open(), _write(), _commit(), _close()
+        #include <process.h>    // Required for: _getpid()
+        #include <sys/stat.h>   // Required for: _S_IREAD, _S_IWRITE
+    #else
+        #include <unistd.h>     // Required for: write(), fsync(), close(), getpid()
+    #endif
+#endif
+
+#if !defined(RGI_NO_STDIO) && defined(_WIN32) && !defined(_WINDOWS_)
+    // NOTE: Declaring required Win32 function to avoid including windows.h, used to replace files
+    // (rename() fails if destination exists), declaration is compatible with windows.h one
+    #if defined(__cplusplus)
+    extern "C" {
+    #endif
+    __declspec(dllimport) int __stdcall MoveFileExA(const char *lpExistingFileName, const char *lpNewFileName, unsigned long dwFlags);
+    #if defined(__cplusplus)
+    }
+    #endif
+#endif
+
+#if !defined(RGI_NO_STDIO) && !defined(RGI_NO_MMAP)
+    #if defined(_WIN32)
+        #if !defined(_WINDOWS_)
+        // NOTE: Declaring required Win32 functions to avoid including windows.h,
+        // it conflicts with several libraries, including raylib (i.e. Rectangle, LoadImage()...)
+        // Declarations are compatible with windows.h ones: HANDLE is void *, DWORD is unsigned long,
+        // LPSECURITY_ATTRIBUTES is struct _SECURITY_ATTRIBUTES *, SIZE_T is unsigned long on 32bit
+        #if defined(__cplusplus)
+        extern "C" {
+        #endif
+        struct _SECURITY_ATTRIBUTES;
+        __declspec(dllimport) void *__stdcall CreateFileA(const char *lpFileName, unsigned long dwDesiredAccess, unsigned long dwShareMode, struct _SECURITY_ATTRIBUTES *lpSecurityAttributes, unsigned long dwCreationDisposition, unsigned long dwFlagsAndAttributes, void *hTemplateFile);
+        __declspec(dllimport) unsigned long __stdcall GetFileSize(void *hFile, unsigned long *lpFileSizeHigh);
+        __declspec(dllimport) void *__stdcall CreateFileMappingA(void *hFile, struct _SECURITY_ATTRIBUTES *lpFileMappingAttributes, unsigned long flProtect, unsigned long dwMaximumSizeHigh, unsigned long dwMaximumSizeLow, const char *lpName);
+        #if defined(_WIN64)
+        __declspec(dllimport) void *__stdcall MapViewOfFile(void *hFileMappingObject, unsigned long dwDesiredAccess, unsigned long dwFileOffsetHigh, unsigned long dwFileOffsetLow, unsigned long long dwNumberOfBytesToMap);
+        #else
+        __declspec(dllimport) void *__stdcall MapViewOfFile(void *hFileMappingObject, unsigned long dwDesiredAccess, unsigned long dwFileOffsetHigh, unsigned long dwFileOffsetLow, unsigned long dwNumberOfBytesToMap);
+        #endif
+        __declspec(dllimport) int __stdcall UnmapViewOfFile(const void *lpBaseAddress);
+        __declspec(dllimport) int __stdcall CloseHandle(void *hObject);
+        #if defined(__cplusplus)
+        }
+        #endif
+        #endif
+    #else
+        #include <sys/mman.h>   // Required for: mmap(), munmap()
+        #include <sys/stat.h>   // Required for: fstat()
+    #endif
+#endif
+
+// SSE2 support for icons transforms, processing one icon per two 128bit registers
+#if !defined(RGI_NO_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define RGI_SIMD_SSE2
+        #include <emmintrin.h>  // Required for: SSE2 intrinsics
+    #endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define RGI_FILE_HEADER_SIZE        12      // File header size: signature, version, reserved, count, size
+#define RGI_FILE_VERSION            500     // File version, aligned with raygui 5.0
+
+#define RGI_ATLAS_ICONS_PER_LINE    16      // Atlas icons per line, for the biggest scale (smaller scales fit more)
+
+//----------------------------------------------------------------------------------
+// Module Internal Types Definition
+//----------------------------------------------------------------------------------
+// Code text buffer, grows on demand, text is written once completed
+typedef struct {
+    char *text;             // Code text
+    int length;             // Code text length
+    int capacity;           // Code text buffer capacity (-1 if allocation failed)
+} rgi_code_buffer;
+
+// Code formatter, iconset code appended to code buffer with a specific layout
+typedef void (*rgi_code_formatter)(rgi_code_buffer *code, rgi_iconset iconset);
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static int validate_iconset_data(const unsigned char *buffer, int size, bool check_names); // Validate iconset data, returns icons count (0 if not valid)
+static int get_icons_range(rgi_iconset iconset, int *first, int count);     // Get valid icons range, clamped to iconset limits
+static unsigned int reverse_rows_bits(unsigned int value);                  // Reverse bits order of the two rows in one data element
+static unsigned short threshold_icon_row(const unsigned char *pixels, int channels);    // Get icon row bits from image pixels (8bit)
+static void transpose_icon_rows(unsigned short *rows);                      // Transpose icon bits matrix (16x16)
+static int find_icon_by_name(rgi_iconset iconset, const char *name, int length);    // Find icon by name id (not NULL terminated), -1 if not found
+static bool get_atlas_layout(int count, const int *scales, int scale_count, int padding, int *width, int *height, int *offsets);    // Get atlas size and scales sections offset
+
+static char *code_reserve(rgi_code_buffer *code, int size);                 // Reserve space at the end of code buffer
+static void code_append(rgi_code_buffer *code, const char *text);           // Append text to code buffer
+static void code_append_padded(rgi_code_buffer *code, const char *text, int width);   // Append text padded with spaces
+static void code_append_int(rgi_code_buffer *code, int value, int digits);  // Append integer value (decimal)
+static void code_append_int_padded(rgi_code_buffer *code, int value, int width);    // Append integer value right aligned, padded with spaces
+static void code_append_ratio(rgi_code_buffer *code, int value, int size);  // Append value/size as float literal (6 decimals, [0..1])
+static void code_append_hex(rgi_code_buffer *code, unsigned int value, int digits);   // Append value as hexadecimal
+static void code_append_icon_name(rgi_code_buffer *code, rgi_iconset iconset, int id, int width);   // Append icon name id (ICON_<name>)
+static void code_append_banner(rgi_code_buffer *code, const char *layout); // Append code file header banner
+static void code_append_section(rgi_code_buffer *code, const char *title);  // Append code section separator
+static void code_append_defines_enum(rgi_code_buffer *code, rgi_iconset iconset);     // Append icons defines and enumeration
+static void code_append_icons_values(rgi_code_buffer *code, rgi_iconset iconset, const char *comment); // Append icons data values
+static void format_code_c(rgi_code_buffer *code, rgi_iconset iconset);      // Code formatter: C layout
+static void format_code_cpp(rgi_code_buffer *code, rgi_iconset iconset);    // Code formatter: C++17 constexpr layout
+static void format_code_blob(rgi_code_buffer *code, rgi_iconset iconset);   // Code formatter: compressed blob layout
+static int pack_bits(const unsigned char *data, int size, unsigned char *output);   // Compress data with PackBits (RLE)
+static void code_append_string(rgi_code_buffer *code, const char *text);    // Append text as a string literal (escaped)
+static unsigned int hash_icon_name(const char *name, unsigned int seed);    // Icon name hash (FNV-1a, seeded)
+static bool build_names_hash(rgi_iconset iconset, unsigned short *seeds, short *slots, int *bucket_count, int *slot_count); // Build icons names perfect hash
+
+//----------------------------------------------------------------------------------
+// Module Internal Variables Definition
+//----------------------------------------------------------------------------------
+// Code formatters, indexed by code format (RGI_CODE_FORMAT_*)
+static const rgi_code_formatter code_formatters[RGI_CODE_FORMAT_COUNT] = { format_code_c, format_code_cpp, format_code_blob };
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Generate an empty iconset (data and names allocated)
+rgi_iconset rgi_gen_iconset(int count)
+{
+    rgi_iconset iconset = { 0 };
+
+    if (count > 0)
+    {
+        iconset.values = (unsigned int *)RGI_CALLOC(count*RGI_ICON_DATA_ELEMENTS, sizeof(unsigned int));
+        iconset.names = (char *)RGI_CALLOC(count*RGI_ICON_MAX_NAME_LENGTH, sizeof(char));
+
+        if ((iconset.values != NULL) && (iconset.names != NULL))
+        {
+            iconset.count = count;
+            iconset.size = RGI_ICON_SIZE;
+        }
+        else
+        {
+            RGI_FREE(iconset.values);
+            RGI_FREE(iconset.names);
+            iconset = (rgi_iconset){ 0 };
+        }
+    }
+
+    return iconset;
+}
+
+// Unload iconset allocated data
+void rgi_unload_iconset(rgi_iconset iconset)
+{
+    RGI_FREE(iconset.values);
+    RGI_FREE(iconset.names);
+}
+
+#if !defined(RGI_NO_STDIO)
+// Load iconset from file (.rgi)
+rgi_iconset rgi_load_iconset(const char *filename)
+{
+    rgi_iconset iconset = { 0 };
+    FILE *rgiFile = fopen(filename, "rb");
+
+    if (rgiFile != NULL)
+    {
+        fseek(rgiFile, 0, SEEK_END);
+        int size = (int)ftell(rgiFile);
+        fseek(rgiFile, 0, SEEK_SET);
+
+        if (size > 0)
+        {
+            unsigned char *buffer = (unsigned char *)RGI_MALLOC(size);
+
+            if ((buffer != NULL) && (fread(buffer, 1, size, rgiFile) == (size_t)size)) iconset = rgi_load_iconset_from_memory(buffer, size);
+
+            RGI_FREE(buffer);
+        }
+
+        fclose(rgiFile);
+    }
+    else RGI_LOG("WARNING: [%s] Iconset file could not be opened\n", filename);
+
+    return iconset;
+}
+#endif
+
+// Load iconset from memory buffer (.rgi)
+rgi_iconset rgi_load_iconset_from_memory(const unsigned char *buffer, int size)
+{
+    // raygui Icons File Structure (.rgi)
+    // ------------------------------------------------------
+    // Offset  | Size    | Type       | Description
+    // ------------------------------------------------------
+    // 0       | 4       | char       | Signature: "rGI "
+    // 4       | 2       | short      | Version: 100, 500 (raygui 5.0)
+    // 6       | 2       | short      | reserved
+
+    // 8       | 2       | short      | Num icons (N)
+    // 10      | 2       | short      | Icons size (Options: 16, 32, 64)
+
+    // Icons name id (32 bytes per name id)
+    // foreach (icon)
+    // {
+    //   12+32*i  | 32   | char       | Icon NameId (RGI_ICON_MAX_NAME_LENGTH)
+    // }
+
+    // Icons data: One bit per pixel, stored as unsigned int array (depends on icon size)
+    // S*S pixels/32bit per unsigned int = K unsigned int per icon
+    // foreach (icon)
+    // {
+    //   ...   | K       | unsigned int | Icon Data
+    // }
+
+    rgi_iconset iconset = { 0 };
+
+    int count = validate_iconset_data(buffer, size, false);
+    if (count == 0) return iconset;
+
+    iconset = rgi_gen_iconset(count);
+
+    if (iconset.values != NULL)
+    {
+        memcpy(iconset.names, buffer + RGI_FILE_HEADER_SIZE, count*RGI_ICON_MAX_NAME_LENGTH);
+        memcpy(iconset.values, buffer + RGI_FILE_HEADER_SIZE + count*RGI_ICON_MAX_NAME_LENGTH, count*RGI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+
+        // Make sure all names are NULL terminated
+        for (int i = 0; i < count; i++) iconset.names[i*RGI_ICON_MAX_NAME_LENGTH + RGI_ICON_MAX_NAME_LENGTH - 1] = '\0';
+    }
+
+    return iconset;
+}
+
+#if !defined(RGI_NO_STDIO)
+// Save iconset to file (.rgi)
+// NOTE: Full file is generated in memory and saved atomically
+int rgi_save_iconset(rgi_iconset iconset, const char *filename)
+{
+    int size = 0;
+    unsigned char *buffer = rgi_save_iconset_to_memory(iconset, &size);
+
+    if (buffer == NULL) return RGI_ERROR_MEMORY_ALLOC;
+
+    int result = rgi_save_file_data(filename, buffer, size);
+
+    RGI_FREE(buffer);
+
+    return result;
+}
+#endif
+
+// Save iconset to memory buffer (.rgi)
+// NOTE: Icons without name are saved with an empty name
+unsigned char *rgi_save_iconset_to_memory(rgi_iconset iconset, int *output_size)
+{
+    *output_size = 0;
+    if ((iconset.values == NULL) || (iconset.count <= 0)) return NULL;
+
+    int size = RGI_FILE_HEADER_SIZE + iconset.count*(RGI_ICON_MAX_NAME_LENGTH + RGI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+    unsigned char *buffer = (unsigned char *)RGI_CALLOC(size, 1);
+
+    if (buffer != NULL)
+    {
+        // WARNING: Version 500 is aligned with raygui 5.0,
+        // up to 512 icons vs 256 on previous versions
+        short version = RGI_FILE_VERSION;
+        short count = (short)iconset.count;
+        short iconSize = RGI_ICON_SIZE;
+
+        memcpy(buffer, "rGI ", 4);
+        memcpy(buffer + 4, &version, sizeof(short));
+        memcpy(buffer + 8, &count, sizeof(short));
+        memcpy(buffer + 10, &iconSize, sizeof(short));
+
+        if (iconset.names != NULL) memcpy(buffer + RGI_FILE_HEADER_SIZE, iconset.names, iconset.count*RGI_ICON_MAX_NAME_LENGTH);
+        memcpy(buffer + RGI_FILE_HEADER_SIZE + iconset.count*RGI_ICON_MAX_NAME_LENGTH, iconset.values, iconset.count*RGI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+
+        *output_size = size;
+    }
+
+    return buffer;
+}
+
+// Export iconset as code to memory buffer (text), using requested format layout
+// NOTE: Code is formatted into one growable buffer, returned text is NULL terminated (not included in size)
+char *rgi_export_iconset_as_code_to_memory(rgi_iconset iconset, int format, int *output_size)
+{
+    *output_size = 0;
+    if ((iconset.values == NULL) || (iconset.count <= 0) || (format < 0) || (format >= RGI_CODE_FORMAT_COUNT)) return NULL;
+
+    // NOTE: Initial capacity fits a full C layout iconset, ~120 bytes per icon (enum line + data line)
+    rgi_code_buffer code = { 0 };
+    code_reserve(&code, 2048 + iconset.count*128);
+
+    code_formatters[format](&code, iconset);
+
+    if (code.text != NULL)
+    {
+        code.text[code.length] = '\0';
+        *output_size = code.length;
+    }
+
+    return code.text;
+}
+
+#if !defined(RGI_NO_STDIO)
+// Export iconset as code file (.h), C layout
+// NOTE: Full code is generated in memory and saved atomically
+int rgi_export_iconset_as_code(rgi_iconset iconset, const char *filename)
+{
+    int size = 0;
+    char *code = rgi_export_iconset_as_code_to_memory(iconset, RGI_CODE_FORMAT_C, &size);
+
+    if (code == NULL) return RGI_ERROR_MEMORY_ALLOC;
+
+    int result = rgi_save_file_data(filename, (const unsigned char *)code, size);
+
+    RGI_FREE(code);
+
+    return result;
+}
+#endif
+
+#if !defined(RGI_NO_STDIO)
+// Map iconset file into memory (read-only, validated)
+rgi_iconset_file rgi_map_iconset(const char *filename)
+{
+    rgi_iconset_file file = { 0 };
+
+#if defined(RGI_NO_MMAP)
+    FILE *rgiFile = fopen(filename, "rb");
+
+    if (rgiFile != NULL)
+    {
+        fseek(rgiFile, 0, SEEK_END);
+        file.size = (int)ftell(rgiFile);
+        fseek(rgiFile, 0, SEEK_SET);
+
+        if (file.size > 0) file.data = (unsigned char *)RGI_MALLOC(file.size);
+        if ((file.data != NULL) && (fread(file.data, 1, file.size, rgiFile) != (size_t)file.size)) { RGI_FREE(file.data); file.data = NULL; }
+
+        fclose(rgiFile);
+    }
+#elif defined(_WIN32)
+    void *fileHandle = CreateFileA(filename, 0x80000000, 0x00000001, NULL, 3, 0x80, NULL); // GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL
+
+    if (fileHandle != (void *)(long long)-1)   // INVALID_HANDLE_VALUE
+    {
+        unsigned long sizeHigh = 0;
+        unsigned long sizeLow = GetFileSize(fileHandle, &sizeHigh);
+
+        if ((sizeHigh == 0) && (sizeLow > 0) && (sizeLow < 0x7fffffff))
+        {
+            file.size = (int)sizeLow;
+            file.mapping = CreateFileMappingA(fileHandle, NULL, 0x02, 0, 0, NULL);     // PAGE_READONLY
+
+            if (file.mapping != NULL)
+            {
+                file.data = (unsigned char *)MapViewOfFile(file.mapping, 0x0004, 0, 0, 0); // FILE_MAP_READ
+                if (file.data == NULL) { CloseHandle(file.mapping); file.mapping = NULL; }
+            }
+        }
+
+        CloseHandle(fileHandle);    // NOTE: Mapping keeps file open until unmapped
+    }
+#else
+    int fd = open(filename, O_RDONLY);
+
+    if (fd >= 0)
+    {
+        struct stat info = { 0 };
+
+        if ((fstat(fd, &info) == 0) && (info.st_size > 0) && (info.st_size < 0x7fffffff))
+        {
+            file.size = (int)info.st_size;
+            void *data = mmap(NULL, file.size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED) file.data = (unsigned char *)data;
+        }
+
+        close(fd);                  // NOTE: Mapping keeps file open until unmapped
+    }
+#endif
+
+    if (file.data == NULL)
+    {
+        RGI_LOG("WARNING: [%s] Iconset file could not be opened\n", filename);
+        return (rgi_iconset_file){ 0 };
+    }
+
+    int count = validate_iconset_data(file.data, file.size, true);
+
+    if (count == 0)
+    {
+        rgi_unmap_iconset(file);
+        return (rgi_iconset_file){ 0 };
+    }
+
+    // NOTE: Icons data offset is a multiple of 4 bytes (12 + 32*count), aligned with mapped data
+    file.iconset.count = count;
+    file.iconset.size = RGI_ICON_SIZE;
+    file.iconset.names = (char *)(file.data + RGI_FILE_HEADER_SIZE);
+    file.iconset.values = (unsigned int *)(file.data + RGI_FILE_HEADER_SIZE + count*RGI_ICON_MAX_NAME_LENGTH);
+
+    return file;
+}
+
+// Unmap iconset file from memory
+void rgi_unmap_iconset(rgi_iconset_file file)
+{
+    if (file.data == NULL) return;
+
+#if defined(RGI_NO_MMAP)
+    RGI_FREE(file.data);
+#elif defined(_WIN32)
+    UnmapViewOfFile(file.data);
+    CloseHandle(file.mapping);
+#else
+    munmap(file.data, file.size);
+#endif
+}
+
+// Save data to file atomically (unique temporary file + flush to disk + rename)
+// NOTE: Temporary file is created exclusively, concurrent writers of the same file never share it,
+// on POSIX systems parent directory is also flushed to make the rename durable
+int rgi_save_file_data(const char *filename, const unsigned char *data, int size)
+{
+    int length = (int)strlen(filename);
+    int tempLength = length + 32;       // Enough for ".<pid>.<n>.tmp" suffix
+    char *tempFileName = (char *)RGI_MALLOC(tempLength);
+
+    if (tempFileName == NULL) return RGI_ERROR_MEMORY_ALLOC;
+
+    int result = RGI_ERROR_FILE_OPEN;
+    int fd = -1;
+
+    // Create temporary file: <filename>.<pid>.<n>.tmp, next n tried if already exists
+    for (int n = 0; (fd == -1) && (n < 100); n++)
+    {
+    #if defined(_WIN32)
+        snprintf(tempFileName, tempLength, "%s.%i.%i.tmp", filename, (int)_getpid(), n);
+        fd = _open(tempFileName, _O_WRONLY | _O_CREAT | _O_EXCL | _O_BINARY, _S_IREAD | _S_IWRITE);
+    #else
+        snprintf(tempFileName, tempLength, "%s.%i.%i.tmp", filename, (int)getpid(), n);
+        fd = open(tempFileName, O_WRONLY | O_CREAT | O_EXCL, 0644);
+    #endif
+        if ((fd == -1) && (errno != EEXIST)) break;
+    }
+
+    if (fd != -1)
+    {
+        result = RGI_SUCCESS;
+
+        for (int offset = 0; (result == RGI_SUCCESS) && (offset < size); )
+        {
+        #if defined(_WIN32)
+            int written = _write(fd, data + offset, (unsigned int)(size - offset));
+        #else
+            int written = (int)write(fd, data + offset, (size_t)(size - offset));
+        #endif
+            if (written <= 0) result = RGI_ERROR_FILE_WRITE;
+            else offset += written;
+        }
+
+        // Flush data to disk before rename, otherwise a crash could replace filename with an empty file
+    #if defined(_WIN32)
+        if ((result == RGI_SUCCESS) && (_commit(fd) != 0)) result = RGI_ERROR_FILE_WRITE;
+        if (_close(fd) != 0) result = RGI_ERROR_FILE_WRITE;
+    #else
+        if ((result == RGI_SUCCESS) && (fsync(fd) != 0)) result = RGI_ERROR_FILE_WRITE;
+        if (close(fd) != 0) result = RGI_ERROR_FILE_WRITE;
+    #endif
+
+        if (result == RGI_SUCCESS)
+        {
+        #if defined(_WIN32)
+            // MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH
+            if (MoveFileExA(tempFileName, filename, 0x00000001 | 0x00000008) == 0) result = RGI_ERROR_FILE_WRITE;
+        #else
+            if (rename(tempFileName, filename) != 0) result = RGI_ERROR_FILE_WRITE;
+        #endif
+        }
+
+        if (result != RGI_SUCCESS) remove(tempFileName);
+    #if !defined(_WIN32)
+        else
+        {
+            // Flush parent directory, rename is only durable once directory entry is on disk
+            // NOTE: Temporary file name buffer reused for directory path, "." if no directory
+            int dirLength = length;
+            while ((dirLength > 0) && (filename[dirLength - 1] != '/')) dirLength--;
+
+            if (dirLength == 0) memcpy(tempFileName, ".", 2);
+            else
+            {
+                memcpy(tempFileName, filename, dirLength);
+                tempFileName[dirLength] = '\0';
+            }
+
+            int dirFd = open(tempFileName, O_RDONLY);
+
+            if (dirFd != -1)
+            {
+                if ((fsync(dirFd) != 0) && (errno != EINVAL)) RGI_LOG("WARNING: [%s] File directory could not be flushed\n", filename);
+                close(dirFd);
+            }
+        }
+    #endif
+    }
+
+    if (result != RGI_SUCCESS) RGI_LOG("WARNING: [%s] File could not be saved\n", filename);
+
+    RGI_FREE(tempFileName);
+
+    return result;
+}
+#endif
+
+// Generate iconset image data (8bit grayscale)
+// NOTE: Icon pixels set are WHITE (255), the rest BLACK (0)
+unsigned char *rgi_gen_image_data(rgi_iconset iconset, int icons_per_line, int padding, int *width, int *height)
+{
+    *width = 0;
+    *height = 0;
+    if ((iconset.values == NULL) || (iconset.count <= 0) || (icons_per_line <= 0) || (padding < 0)) return NULL;
+
+    int lines = iconset.count/icons_per_line;
+    if (iconset.count%icons_per_line > 0) lines++;
+
+    int imageWidth = (RGI_ICON_SIZE + 2*padding)*icons_per_line;
+    int imageHeight = (RGI_ICON_SIZE + 2*padding)*lines;
+    unsigned char *data = (unsigned char *)RGI_CALLOC(imageWidth*imageHeight, 1);   // All pixels BLACK by default
+
+    if (data == NULL) return NULL;
+
+    for (int n = 0; n < iconset.count; n++)
+    {
+        int offsetX = padding + (n%icons_per_line)*(RGI_ICON_SIZE + 2*padding);
+        int offsetY = padding + (n/icons_per_line)*(RGI_ICON_SIZE + 2*padding);
+
+        for (int y = 0; y < RGI_ICON_SIZE; y++)
+        {
+            unsigned short row = rgi_get_icon_row(iconset, n, y);
+            unsigned char *pixels = data + (offsetY + y)*imageWidth + offsetX;
+
+            for (int x = 0; x < RGI_ICON_SIZE; x++) if (row & (1u << x)) pixels[x] = 0xff;  // Draw pixel WHITE
+        }
+    }
+
+    *width = imageWidth;
+    *height = imageHeight;
+
+    return data;
+}
+
+// Generate iconset image data, packed 1bit
+// NOTE: Scanlines are packed as required by PNG 1bit grayscale: MSB first, rows padded to byte,
+// icon rows are bit reversed and written directly from icons data, 16 pixels at once
+unsigned char *rgi_gen_image_bits(rgi_iconset iconset, int icons_per_line, int padding, int *width, int *height)
+{
+    *width = 0;
+    *height = 0;
+    if ((iconset.values == NULL) || (iconset.count <= 0) || (icons_per_line <= 0) || (padding < 0)) return NULL;
+
+    int lines = iconset.count/icons_per_line;
+    if (iconset.count%icons_per_line > 0) lines++;
+
+    int imageWidth = (RGI_ICON_SIZE + 2*padding)*icons_per_line;
+    int imageHeight = (RGI_ICON_SIZE + 2*padding)*lines;
+    int stride = (imageWidth + 7)/8;
+
+    // NOTE: Two extra bytes allocated, icon rows are written as 24 bit values (unaligned offsets)
+    unsigned char *data = (unsigned char *)RGI_CALLOC(stride*imageHeight + 2, 1);   // All pixels BLACK by default
+
+    if (data == NULL) return NULL;
+
+    for (int n = 0; n < iconset.count; n++)
+    {
+        int offsetX = padding + (n%icons_per_line)*(RGI_ICON_SIZE + 2*padding);
+        int offsetY = padding + (n/icons_per_line)*(RGI_ICON_SIZE + 2*padding);
+        unsigned char *pixels = data + offsetY*stride + offsetX/8;
+        int shift = offsetX%8;
+
+        const unsigned int *values = iconset.values + n*RGI_ICON_DATA_ELEMENTS;
+
+        for (int i = 0; i < RGI_ICON_DATA_ELEMENTS; i++)
+        {
+            // Every data element contains two rows, pixel x is bit (15 - x) once reversed
+            unsigned int rows = reverse_rows_bits(values[i]);
+
+            for (int k = 0; k < 2; k++, pixels += stride)
+            {
+                unsigned int bits = ((rows >> (k*16)) & 0xffff) << (8 - shift);
+
+                pixels[0] |= (unsigned char)(bits >> 16);
+                pixels[1] |= (unsigned char)(bits >> 8);
+                pixels[2] |= (unsigned char)bits;
+            }
+        }
+    }
+
+    *width = imageWidth;
+    *height = imageHeight;
+
+    return data;
+}
+
+// Load iconset from image data (1-4 channels, 8bit)
+// NOTE: Pixel is considered set if first channel (and alpha, if available) is bright (>= 128)
+rgi_iconset rgi_load_iconset_from_image_data(const unsigned char *data, int width, int height, int channels, int icon_count, int icons_per_line, int padding)
+{
+    rgi_iconset iconset = { 0 };
+
+    if ((data == NULL) || (channels < 1) || (channels > 4) || (icons_per_line <= 0) || (padding < 0)) return iconset;
+
+    int lines = icon_count/icons_per_line;
+    if (icon_count%icons_per_line > 0) lines++;
+
+    // Check image size is big enough for requested icons layout
+    if (((RGI_ICON_SIZE + 2*padding)*icons_per_line > width) || ((RGI_ICON_SIZE + 2*padding)*lines > height))
+    {
+        RGI_LOG("WARNING: Image size not valid for requested icons layout\n");
+        return iconset;
+    }
+
+    iconset = rgi_gen_iconset(icon_count);
+
+    for (int n = 0; n < iconset.count; n++)
+    {
+        int offsetX = padding + (n%icons_per_line)*(RGI_ICON_SIZE + 2*padding);
+        int offsetY = padding + (n/icons_per_line)*(RGI_ICON_SIZE + 2*padding);
+
+        for (int y = 0; y < RGI_ICON_SIZE; y++)
+        {
+            const unsigned char *pixels = data + ((offsetY + y)*width + offsetX)*channels;
+
+            rgi_set_icon_row(iconset, n, y, threshold_icon_row(pixels, channels));
+        }
+    }
+
+    return iconset;
+}
+
+// Load iconset from image data, packed 1bit
+// NOTE: Scanlines expected as PNG 1bit grayscale: MSB first, rows padded to byte,
+// icon rows are read 16 pixels at once and bit reversed directly into icons data
+rgi_iconset rgi_load_iconset_from_image_bits(const unsigned char *data, int width, int height, int icon_count, int icons_per_line, int padding)
+{
+    rgi_iconset iconset = { 0 };
+
+    if ((data == NULL) || (icons_per_line <= 0) || (padding < 0)) return iconset;
+
+    int lines = icon_count/icons_per_line;
+    if (icon_count%icons_per_line > 0) lines++;
+
+    // Check image size is big enough for requested icons layout
+    if (((RGI_ICON_SIZE + 2*padding)*icons_per_line > width) || ((RGI_ICON_SIZE + 2*padding)*lines > height))
+    {
+        RGI_LOG("WARNING: Image size not valid for requested icons layout\n");
+        return iconset;
+    }
+
+    iconset = rgi_gen_iconset(icon_count);
+
+    int stride = (width + 7)/8;
+
+    for (int n = 0; n < iconset.count; n++)
+    {
+        int offsetX = padding + (n%icons_per_line)*(RGI_ICON_SIZE + 2*padding);
+        int offsetY = padding + (n/icons_per_line)*(RGI_ICON_SIZE + 2*padding);
+        const unsigned char *pixels = data + offsetY*stride + offsetX/8;
+        int shift = offsetX%8;
+
+        unsigned int *values = iconset.values + n*RGI_ICON_DATA_ELEMENTS;
+
+        for (int i = 0; i < RGI_ICON_DATA_ELEMENTS; i++)
+        {
+            unsigned int rows = 0;
+
+            for (int k = 0; k < 2; k++, pixels += stride)
+            {
+                // NOTE: Third byte only required (and available in scanline) for unaligned offsets
+                unsigned int bits = (pixels[0] << 16) | (pixels[1] << 8) | ((shift > 0)? pixels[2] : 0);
+                rows |= ((bits >> (8 - shift)) & 0xffff) << (k*16);
+            }
+
+            // Every data element contains two rows, pixel x is bit (15 - x) before reversing
+            values[i] = reverse_rows_bits(rows);
+        }
+    }
+
+    return iconset;
+}
+
+// Set icons rows from one image row (1-4 channels 8bit, or packed 1bit scanline)
+// NOTE: Only icons rows intersecting image row are set, image rows on cells padding are skipped,
+// iconset must be generated in advance (rgi_gen_iconset()) with the icons count expected
+void rgi_set_icons_from_image_row(rgi_iconset iconset, const unsigned char *row, int y, int width, int channels, int bit_depth, int icons_per_line, int padding)
+{
+    if ((row == NULL) || (y < 0) || (icons_per_line <= 0) || (padding < 0)) return;
+    if ((bit_depth != 1) && ((bit_depth != 8) || (channels < 1) || (channels > 4))) return;
+
+    int cell = RGI_ICON_SIZE + 2*padding;
+    int line = y/cell;
+    int iconY = y%cell - padding;
+    if ((iconY < 0) || (iconY >= RGI_ICON_SIZE)) return;
+
+    for (int i = 0; i < icons_per_line; i++)
+    {
+        int n = line*icons_per_line + i;
+        int offsetX = padding + i*cell;
+        if ((n >= iconset.count) || (offsetX + RGI_ICON_SIZE > width)) break;
+
+        unsigned short bits = 0;
+
+        if (bit_depth == 1)
+        {
+            // NOTE: Third byte only required (and available in scanline) for unaligned offsets
+            const unsigned char *pixels = row + offsetX/8;
+            int shift = offsetX%8;
+            unsigned int value = (pixels[0] << 16) | (pixels[1] << 8) | ((shift > 0)? pixels[2] : 0);
+
+            bits = (unsigned short)(reverse_rows_bits((value >> (8 - shift)) & 0xffff) & 0xffff);
+        }
+        else bits = threshold_icon_row(row + offsetX*channels, channels);
+
+        rgi_set_icon_row(iconset, n, iconY, bits);
+    }
+}
+
+// Scan source text for icons usage, used icons marked (used array, iconset.count elements)
+// NOTE: Comments are skipped, "#NNN#" markers (1-3 digits, same as raygui) are only checked in string
+// literals, identifiers followed by '=' are enum values definitions (i.e. raygui.h), not considered usage,
+// icons without name id are matched by index (ICON_005), same as exported code enumeration
+int rgi_scan_icons_usage(rgi_iconset iconset, const char *text, int size, bool *used)
+{
+    if ((text == NULL) || (used == NULL)) return 0;
+
+    int count = 0;
+    int i = 0;
+
+    while (i < size)
+    {
+        char c = text[i];
+
+        if ((c == '/') && ((i + 1) < size) && (text[i + 1] == '/'))
+        {
+            while ((i < size) && (text[i] != '\n')) i++;
+        }
+        else if ((c == '/') && ((i + 1) < size) && (text[i + 1] == '*'))
+        {
+            i += 2;
+            while (((i + 1) < size) && !((text[i] == '*') && (text[i + 1] == '/'))) i++;
+            i += 2;
+        }
+        else if ((c == '"') || (c == '\''))
+        {
+            // String or char literal, escaped chars skipped, ends on closing quote or line end
+            for (i++; (i < size) && (text[i] != c) && (text[i] != '\n'); i++)
+            {
+                if (text[i] == '\\') i++;
+                else if ((c == '"') && (text[i] == '#'))
+                {
+                    int id = 0;
+                    int digits = 0;
+                    while (((i + 1 + digits) < size) && (digits < 3) && (text[i + 1 + digits] >= '0') && (text[i + 1 + digits] <= '9'))
+                    {
+                        id = id*10 + (text[i + 1 + digits] - '0');
+                        digits++;
+                    }
+
+                    // NOTE: Closing '#' not skipped, it could start next marker
+                    if ((digits > 0) && ((i + 1 + digits) < size) && (text[i + 1 + digits] == '#'))
+                    {
+                        if ((id < iconset.count) && !used[id]) { used[id] = true; count++; }
+                        i += digits;
+                    }
+                }
+            }
+            i++;
+        }
+        else if (((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || ((c >= '0') && (c <= '9')) || (c == '_'))
+        {
+            // Identifier or number, only identifiers starting with ICON_ are checked
+            int start = i;
+            while ((i < size) && (((text[i] >= 'a') && (text[i] <= 'z')) || ((text[i] >= 'A') && (text[i] <= 'Z')) ||
+                   ((text[i] >= '0') && (text[i] <= '9')) || (text[i] == '_'))) i++;
+
+            int length = i - start - 5;
+            if ((length <= 0) || (length >= RGI_ICON_MAX_NAME_LENGTH) || (memcmp(text + start, "ICON_", 5) != 0)) continue;
+
+            int next = i;
+            while ((next < size) && ((text[next] == ' ') || (text[next] == '\t'))) next++;
+            if ((next < size) && (text[next] == '=') && (((next + 1) >= size) || (text[next + 1] != '='))) continue;
+
+            int id = find_icon_by_name(iconset, text + start + 5, length);
+
+            if ((id == -1) && (length <= 4))
+            {
+                id = 0;
+                for (int k = 0; (k < length) && (id != -1); k++)
+                {
+                    char digit = text[start + 5 + k];
+                    id = ((digit >= '0') && (digit <= '9'))? id*10 + (digit - '0') : -1;
+                }
+
+                const char *name = rgi_get_icon_name(iconset, id);
+                if ((id >= iconset.count) || ((name != NULL) && (name[0] != '\0'))) id = -1;
+            }
+
+            if ((id >= 0) && !used[id]) { used[id] = true; count++; }
+        }
+        else i++;
+    }
+
+    return count;
+}
+
+// Generate iconset with used icons only, icons data and names copied, original order kept
+// NOTE: Used icons without name id get their original index as name (005), exported code enumeration
+// keeps the same identifiers used by sources (ICON_005), remap must contain iconset.count elements
+rgi_iconset rgi_gen_iconset_trimmed(rgi_iconset iconset, const bool *used, int *remap)
+{
+    rgi_iconset trimmed = { 0 };
+    if ((iconset.values == NULL) || (used == NULL) || (remap == NULL)) return trimmed;
+
+    int count = 0;
+    for (int i = 0; i < iconset.count; i++) remap[i] = used[i]? count++ : -1;
+
+    trimmed = rgi_gen_iconset(count);
+
+    for (int i = 0; (i < iconset.count) && (trimmed.count > 0); i++)
+    {
+        if (remap[i] == -1) continue;
+
+        rgi_set_icon_data(trimmed, remap[i], rgi_get_icon_view(iconset, i));
+
+        const char *name = rgi_get_icon_name(iconset, i);
+
+        if ((name != NULL) && (name[0] != '\0')) rgi_set_icon_name(trimmed, remap[i], name);
+        else
+        {
+            // NOTE: Index formatted as %03i, up to 4 digits
+            char index[5] = { 0 };
+            int length = (i >= 1000)? 4 : 3;
+            for (int k = length - 1, value = i; k >= 0; k--, value /= 10) index[k] = (char)('0' + value%10);
+
+            rgi_set_icon_name(trimmed, remap[i], index);
+        }
+    }
+
+    return trimmed;
+}
+
+// Export icons remap table as code to memory buffer (text, C header)
+// NOTE: Remap table translates original iconset ids (i.e. "#NNN#" text markers or ids computed at runtime)
+// into trimmed iconset ids, trimmed iconset enumeration is exported with trimmed iconset code
+char *rgi_export_icons_remap_as_code_to_memory(rgi_iconset iconset, const int *remap, int *output_size)
+{
+    *output_size = 0;
+    if ((remap == NULL) || (iconset.count <= 0)) return NULL;
+
+    int trimmedCount = 0;
+    for (int i = 0; i < iconset.count; i++) if (remap[i] >= 0) trimmedCount++;
+
+    // NOTE: Initial capacity fits the full table, 16 ids per line (~100 bytes) plus used icons list
+    rgi_code_buffer code = { 0 };
+    code_reserve(&code, 2048 + iconset.count*8 + trimmedCount*48);
+
+    code_append_banner(&code, "Icons remap table, trimmed iconset");
+    code_append_section(&code, "Defines and Macros");
+    code_append(&code, "#define RAYGUI_ICON_REMAP_COUNT     ");
+    code_append_int(&code, iconset.count, 0);
+    code_append(&code, "   // Number of icons on original iconset\n#define RAYGUI_ICON_TRIMMED_COUNT   ");
+    code_append_int(&code, trimmedCount, 0);
+    code_append(&code, "   // Number of icons on trimmed iconset\n\n");
+    code_append(&code, "// Get trimmed iconset icon id from original icon id, -1 if icon not available\n");
+    code_append(&code, "#define GUI_ICON_REMAP(id)  ((((id) >= 0) && ((id) < RAYGUI_ICON_REMAP_COUNT))? guiIconsRemap[(id)] : -1)\n\n");
+
+    code_append_section(&code, "Icons remap table");
+    code_append(&code, "// Used icons (original id -> trimmed id):\n");
+    for (int i = 0; i < iconset.count; i++)
+    {
+        if (remap[i] < 0) continue;
+
+        code_append(&code, "//   ");
+        code_append_int(&code, i, 3);
+        code_append(&code, " -> ");
+        code_append_int(&code, remap[i], 3);
+        code_append(&code, "   ");
+        code_append_icon_name(&code, iconset, i, 0);
+        code_append(&code, "\n");
+    }
+
+    code_append(&code, "static const short guiIconsRemap[RAYGUI_ICON_REMAP_COUNT] = {\n");
+    for (int i = 0; i < iconset.count; i++)
+    {
+        if ((i%16) == 0) code_append(&code, "   ");
+        code_append_int_padded(&code, remap[i], 4);
+        code_append(&code, (i == (iconset.count - 1))? "\n" : ((i%16) == 15)? ",\n" : ", ");
+    }
+    code_append(&code, "};\n");
+
+    if (code.text != NULL)
+    {
+        code.text[code.length] = '\0';
+        *output_size = code.length;
+    }
+
+    return code.text;
+}
+
+// Generate iconset atlas data (8bit, single channel), icons rasterized at every scale
+// NOTE: Icon pixels set are 255 (coverage), the rest 0, scaled rows are rasterized once and copied
+unsigned char *rgi_gen_atlas_data(rgi_iconset iconset, const int *scales, int scale_count, int padding, int *width, int *height)
+{
+    *width = 0;
+    *height = 0;
+
+    int offsets[RGI_ATLAS_MAX_SCALES] = { 0 };
+    int atlasWidth = 0;
+    int atlasHeight = 0;
+
+    if ((iconset.values == NULL) || !get_atlas_layout(iconset.count, scales, scale_count, padding, &atlasWidth, &atlasHeight, offsets)) return NULL;
+
+    unsigned char *data = (unsigned char *)RGI_CALLOC(atlasWidth*atlasHeight, 1);   // All pixels clear by default
+
+    if (data == NULL) return NULL;
+
+    for (int s = 0; s < scale_count; s++)
+    {
+        int scale = scales[s];
+        int cell = RGI_ICON_SIZE*scale + 2*padding;
+        int iconsPerLine = atlasWidth/cell;
+
+        for (int n = 0; n < iconset.count; n++)
+        {
+            int offsetX = padding + (n%iconsPerLine)*cell;
+            int offsetY = offsets[s] + padding + (n/iconsPerLine)*cell;
+
+            for (int y = 0; y < RGI_ICON_SIZE; y++)
+            {
+                unsigned short row = rgi_get_icon_row(iconset, n, y);
+                if (row == 0) continue;
+
+                unsigned char *pixels = data + (offsetY + y*scale)*atlasWidth + offsetX;
+
+                for (int x = 0; x < RGI_ICON_SIZE; x++) if (row & (1u << x)) memset(pixels + x*scale, 0xff, scale);
+                for (int k = 1; k < scale; k++) memcpy(pixels + k*atlasWidth, pixels, RGI_ICON_SIZE*scale);
+            }
+        }
+    }
+
+    *width = atlasWidth;
+    *height = atlasHeight;
+
+    return data;
+}
+
+// Export atlas icons rectangles and UVs as code to memory buffer (text, C header)
+// NOTE: Atlas layout must match the one used to generate atlas data (same scales and padding),
+// rectangles are provided in pixels (i.e. raylib DrawTexturePro() source) and normalized (UVs)
+char *rgi_export_atlas_as_code_to_memory(rgi_iconset iconset, const int *scales, int scale_count, int padding, int *output_size)
+{
+    *output_size = 0;
+
+    int offsets[RGI_ATLAS_MAX_SCALES] = { 0 };
+    int atlasWidth = 0;
+    int atlasHeight = 0;
+
+    if (!get_atlas_layout(iconset.count, scales, scale_count, padding, &atlasWidth, &atlasHeight, offsets)) return NULL;
+
+    // NOTE: Initial capacity fits rectangles and UVs lines, ~160 bytes per icon and scale
+    rgi_code_buffer code = { 0 };
+    code_reserve(&code, 2048 + iconset.count*scale_count*160);
+
+    code_append_banner(&code, "Icons atlas rectangles and UVs");
+    code_append_section(&code, "Defines and Macros");
+    code_append(&code, "#define RAYGUI_ICONS_ATLAS_WIDTH    ");
+    code_append_int_padded(&code, atlasWidth, 5);
+    code_append(&code, "   // Icons atlas width (pixels)\n#define RAYGUI_ICONS_ATLAS_HEIGHT   ");
+    code_append_int_padded(&code, atlasHeight, 5);
+    code_append(&code, "   // Icons atlas height (pixels)\n#define RAYGUI_ICONS_ATLAS_ICONS    ");
+    code_append_int_padded(&code, iconset.count, 5);
+    code_append(&code, "   // Number of icons (for every scale)\n#define RAYGUI_ICONS_ATLAS_SCALES   ");
+    code_append_int_padded(&code, scale_count, 5);
+    code_append(&code, "   // Number of icons scales\n\n");
+    code_append(&code, "// Icons atlas data is 8bit single channel, icons coverage (alpha): pixels set 255, the rest 0\n");
+    code_append(&code, "// NOTE: Using raylib, atlas can be applied as alpha mask to a WHITE image (ImageAlphaMask()),\n");
+    code_append(&code, "// every icon is drawn as one textured quad (DrawTexturePro()), tinted with required color\n\n");
+
+    code_append_section(&code, "Icons atlas scales");
+    code_append(&code, "static const int guiIconsAtlasScale[RAYGUI_ICONS_ATLAS_SCALES] = { ");
+    for (int s = 0; s < scale_count; s++)
+    {
+        code_append_int(&code, scales[s], 0);
+        code_append(&code, (s < (scale_count - 1))? ", " : " };\n\n");
+    }
+
+    code_append_section(&code, "Icons atlas rectangles and UVs");
+
+    for (int table = 0; table < 2; table++)
+    {
+        if (table == 0)
+        {
+            code_append(&code, "// Icons rectangles on atlas (pixels): x, y, width, height, indexed by [scale][icon]\n");
+            code_append(&code, "static const unsigned short guiIconsAtlasRecs[RAYGUI_ICONS_ATLAS_SCALES][RAYGUI_ICONS_ATLAS_ICONS][4] = {\n");
+        }
+        else
+        {
+            code_append(&code, "// Icons texture coordinates (normalized): u0, v0, u1, v1, indexed by [scale][icon]\n");
+            code_append(&code, "static const float guiIconsAtlasUVs[RAYGUI_ICONS_ATLAS_SCALES][RAYGUI_ICONS_ATLAS_ICONS][4] = {\n");
+        }
+
+        for (int s = 0; s < scale_count; s++)
+        {
+            int size = RGI_ICON_SIZE*scales[s];
+            int cell = size + 2*padding;
+            int iconsPerLine = atlasWidth/cell;
+
+            code_append(&code, "    {   // Icons scale: ");
+            code_append_int(&code, scales[s], 0);
+            code_append(&code, "x\n");
+
+            for (int n = 0; n < iconset.count; n++)
+            {
+                int x = padding + (n%iconsPerLine)*cell;
+                int y = offsets[s] + padding + (n/iconsPerLine)*cell;
+
+                code_append(&code, "        { ");
+                if (table == 0)
+                {
+                    code_append_int_padded(&code, x, 4);
+                    code_append(&code, ", ");
+                    code_append_int_padded(&code, y, 4);
+                    code_append(&code, ", ");
+                    code_append_int_padded(&code, size, 3);
+                    code_append(&code, ", ");
+                    code_append_int_padded(&code, size, 3);
+                }
+                else
+                {
+                    code_append_ratio(&code, x, atlasWidth);
+                    code_append(&code, ", ");
+                    code_append_ratio(&code, y, atlasHeight);
+                    code_append(&code, ", ");
+                    code_append_ratio(&code, x + size, atlasWidth);
+                    code_append(&code, ", ");
+                    code_append_ratio(&code, y + size, atlasHeight);
+                }
+                code_append(&code, " },     // ");
+                code_append_icon_name(&code, iconset, n, 0);
+                code_append(&code, "\n");
+            }
+
+            code_append(&code, "    },\n");
+        }
+
+        code_append(&code, (table == 0)? "};\n\n" : "};\n");
+    }
+
+    if (code.text != NULL)
+    {
+        code.text[code.length] = '\0';
+        *output_size = code.length;
+    }
+
+    return code.text;
+}
+
+// Get icon data view
+// NOTE: Returned pointer points directly into the iconset (no copy), NULL if icon id not valid
+const unsigned int *rgi_get_icon_view(rgi_iconset iconset, int id)
+{
+    if ((id < 0) || (id >= iconset.count)) return NULL;
+
+    return &iconset.values[id*RGI_ICON_DATA_ELEMENTS];
+}
+
+// Set icon data (RGI_ICON_DATA_ELEMENTS values)
+void rgi_set_icon_data(rgi_iconset iconset, int id, const unsigned int *data)
+{
+    if ((id >= 0) && (id < iconset.count)) memcpy(&iconset.values[id*RGI_ICON_DATA_ELEMENTS], data, RGI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+}
+
+// Get icon row bits (16 pixels)
+// NOTE: Every data element contains two rows, first row on lower bits, first pixel on lower bit
+unsigned short rgi_get_icon_row(rgi_iconset iconset, int id, int row)
+{
+    return (unsigned short)(iconset.values[id*RGI_ICON_DATA_ELEMENTS + row/2] >> ((row%2)*16));
+}
+
+// Set icon row bits (16 pixels)
+void rgi_set_icon_row(rgi_iconset iconset, int id, int row, unsigned short bits)
+{
+    unsigned int *element = &iconset.values[id*RGI_ICON_DATA_ELEMENTS + row/2];
+    int shift = (row%2)*16;
+
+    *element = (*element & ~(0xffffu << shift)) | ((unsigned int)bits << shift);
+}
+
+// Set icon pixel
+void rgi_set_icon_pixel(rgi_iconset iconset, int id, int x, int y)
+{
+    iconset.values[id*RGI_ICON_DATA_ELEMENTS + y/2] |= (1u << (x + (y%2)*16));
+}
+
+// Clear icon pixel
+void rgi_clear_icon_pixel(rgi_iconset iconset, int id, int x, int y)
+{
+    iconset.values[id*RGI_ICON_DATA_ELEMENTS + y/2] &= ~(1u << (x + (y%2)*16));
+}
+
+// Check icon pixel
+bool rgi_check_icon_pixel(rgi_iconset iconset, int id, int x, int y)
+{
+    return ((iconset.values[id*RGI_ICON_DATA_ELEMENTS + y/2] & (1u << (x + (y%2)*16))) != 0);
+}
+
+// Get icon name id, NULL if not available
+const char *rgi_get_icon_name(rgi_iconset iconset, int id)
+{
+    if ((iconset.names == NULL) || (id < 0) || (id >= iconset.count)) return NULL;
+
+    return &iconset.names[id*RGI_ICON_MAX_NAME_LENGTH];
+}
+
+// Set icon name id (up to RGI_ICON_MAX_NAME_LENGTH - 1 chars)
+void rgi_set_icon_name(rgi_iconset iconset, int id, const char *name)
+{
+    if ((iconset.names == NULL) || (id < 0) || (id >= iconset.count)) return;
+
+    char *iconName = &iconset.names[id*RGI_ICON_MAX_NAME_LENGTH];
+    int length = (name != NULL)? (int)strlen(name) : 0;
+    if (length > (RGI_ICON_MAX_NAME_LENGTH - 1)) length = RGI_ICON_MAX_NAME_LENGTH - 1;
+
+    memset(iconName, 0, RGI_ICON_MAX_NAME_LENGTH);
+    if (length > 0) memcpy(iconName, name, length);
+}
+
+#if defined(RGI_SIMD_SSE2)
+// Reverse bits order of 16 bit rows (8 rows per register)
+static __m128i reverse_rows_bits_sse2(__m128i rows)
+{
+    const __m128i m1 = _mm_set1_epi16(0x5555);
+    const __m128i m2 = _mm_set1_epi16(0x3333);
+    const __m128i m4 = _mm_set1_epi16(0x0f0f);
+
+    rows = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(rows, m1), 1), _mm_and_si128(_mm_srli_epi16(rows, 1), m1));
+    rows = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(rows, m2), 2), _mm_and_si128(_mm_srli_epi16(rows, 2), m2));
+    rows = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(rows, m4), 4), _mm_and_si128(_mm_srli_epi16(rows, 4), m4));
+    rows = _mm_or_si128(_mm_slli_epi16(rows, 8), _mm_srli_epi16(rows, 8));
+
+    return rows;
+}
+
+// Reverse rows order (8 rows per register)
+static __m128i reverse_rows_order_sse2(__m128i rows)
+{
+    rows = _mm_shufflelo_epi16(rows, _MM_SHUFFLE(0, 1, 2, 3));
+    rows = _mm_shufflehi_epi16(rows, _MM_SHUFFLE(0, 1, 2, 3));
+    rows = _mm_shuffle_epi32(rows, _MM_SHUFFLE(1, 0, 3, 2));
+
+    return rows;
+}
+#endif
+
+// Flip icons horizontally
+void rgi_flip_icons_h(rgi_iconset iconset, int first, int count)
+{
+    count = get_icons_range(iconset, &first, count);
+    unsigned int *data = &iconset.values[first*RGI_ICON_DATA_ELEMENTS];
+
+#if defined(RGI_SIMD_SSE2)
+    for (int i = 0; i < count*RGI_ICON_DATA_ELEMENTS; i += 4)
+    {
+        __m128i rows = _mm_loadu_si128((__m128i *)&data[i]);
+        _mm_storeu_si128((__m128i *)&data[i], reverse_rows_bits_sse2(rows));
+    }
+#else
+    for (int i = 0; i < count*RGI_ICON_DATA_ELEMENTS; i++) data[i] = reverse_rows_bits(data[i]);
+#endif
+}
+
+// Flip icons vertically
+void rgi_flip_icons_v(rgi_iconset iconset, int first, int count)
+{
+    count = get_icons_range(iconset, &first, count);
+
+    for (int n = first; n < (first + count); n++)
+    {
+        unsigned int *icon = &iconset.values[n*RGI_ICON_DATA_ELEMENTS];
+
+#if defined(RGI_SIMD_SSE2)
+        __m128i top = _mm_loadu_si128((__m128i *)&icon[0]);
+        __m128i bottom = _mm_loadu_si128((__m128i *)&icon[4]);
+        _mm_storeu_si128((__m128i *)&icon[0], reverse_rows_order_sse2(bottom));
+        _mm_storeu_si128((__m128i *)&icon[4], reverse_rows_order_sse2(top));
+#else
+        // Swapping data elements also requires swapping the two rows contained
+        for (int i = 0; i < RGI_ICON_DATA_ELEMENTS/2; i++)
+        {
+            unsigned int temp = icon[i];
+            icon[i] = (icon[RGI_ICON_DATA_ELEMENTS - 1 - i] << 16) | (icon[RGI_ICON_DATA_ELEMENTS - 1 - i] >> 16);
+            icon[RGI_ICON_DATA_ELEMENTS - 1 - i] = (temp << 16) | (temp >> 16);
+        }
+#endif
+    }
+}
+
+// Rotate icons clockwise (90, 180, 270 degrees)
+// NOTE: Rotation 90 is computed as transpose + flip horizontal, rotation 270 as transpose + flip vertical
+void rgi_rotate_icons(rgi_iconset iconset, int first, int count, int degrees)
+{
+    degrees = ((degrees%360) + 360)%360;
+
+    if (degrees == 180)
+    {
+        rgi_flip_icons_h(iconset, first, count);
+        rgi_flip_icons_v(iconset, first, count);
+    }
+    else if ((degrees == 90) || (degrees == 270))
+    {
+        count = get_icons_range(iconset, &first, count);
+
+        for (int n = first; n < (first + count); n++)
+        {
+            unsigned short rows[RGI_ICON_SIZE] = { 0 };
+
+            for (int y = 0; y < RGI_ICON_SIZE; y++) rows[y] = rgi_get_icon_row(iconset, n, y);
+
+            transpose_icon_rows(rows);
+
+            for (int y = 0; y < RGI_ICON_SIZE; y++)
+            {
+                if (degrees == 90) rgi_set_icon_row(iconset, n, y, (unsigned short)reverse_rows_bits(rows[y]));
+                else rgi_set_icon_row(iconset, n, y, rows[RGI_ICON_SIZE - 1 - y]);
+            }
+        }
+    }
+}
+
+// Shift icons pixels, cleared pixels filled with 0
+// NOTE: Positive offsets shift pixels right/down, pixels out of the icon are lost
+void rgi_shift_icons(rgi_iconset iconset, int first, int count, int offset_x, int offset_y)
+{
+    count = get_icons_range(iconset, &first, count);
+
+    for (int n = first; n < (first + count); n++)
+    {
+        unsigned short rows[RGI_ICON_SIZE] = { 0 };
+
+        for (int y = 0; y < RGI_ICON_SIZE; y++)
+        {
+            int srcY = y - offset_y;
+            if ((srcY < 0) || (srcY >= RGI_ICON_SIZE)) continue;
+
+            unsigned int row = rgi_get_icon_row(iconset, n, srcY);
+
+            if ((offset_x >= RGI_ICON_SIZE) || (offset_x <= -RGI_ICON_SIZE)) row = 0;
+            else if (offset_x > 0) row <<= offset_x;
+            else if (offset_x < 0) row >>= -offset_x;
+
+            rows[y] = (unsigned short)row;
+        }
+
+        for (int y = 0; y < RGI_ICON_SIZE; y++) rgi_set_icon_row(iconset, n, y, rows[y]);
+    }
+}
+
+// Invert icons pixels
+void rgi_invert_icons(rgi_iconset iconset, int first, int count)
+{
+    count = get_icons_range(iconset, &first, count);
+    unsigned int *data = &iconset.values[first*RGI_ICON_DATA_ELEMENTS];
+
+#if defined(RGI_SIMD_SSE2)
+    const __m128i ones = _mm_set1_epi32(-1);
+
+    for (int i = 0; i < count*RGI_ICON_DATA_ELEMENTS; i += 4)
+    {
+        __m128i rows = _mm_loadu_si128((__m128i *)&data[i]);
+        _mm_storeu_si128((__m128i *)&data[i], _mm_xor_si128(rows, ones));
+    }
+#else
+    for (int i = 0; i < count*RGI_ICON_DATA_ELEMENTS; i++) data[i] = ~data[i];
+#endif
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Validate iconset data, returns icons count (0 if not valid)
+// NOTE: Header, icons count and size are checked against data size, optionally
+// icons names are checked to be NULL terminated (required to access them without copy)
+static int validate_iconset_data(const unsigned char *buffer, int size, bool check_names)
+{
+    if ((buffer == NULL) || (size < RGI_FILE_HEADER_SIZE) || (memcmp(buffer, "rGI ", 4) != 0))
+    {
+        RGI_LOG("WARNING: Iconset data not valid\n");
+        return 0;
+    }
+
+    short count = 0;
+    short iconSize = 0;
+    memcpy(&count, buffer + 8, sizeof(short));
+    memcpy(&iconSize, buffer + 10, sizeof(short));
+
+    // Check icons count and size against data size
+    if ((count <= 0) || (iconSize != RGI_ICON_SIZE) ||
+        ((RGI_FILE_HEADER_SIZE + count*(RGI_ICON_MAX_NAME_LENGTH + RGI_ICON_DATA_ELEMENTS*(int)sizeof(unsigned int))) > size))
+    {
+        RGI_LOG("WARNING: Iconset data not valid, icons count or size not supported\n");
+        return 0;
+    }
+
+    if (check_names)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            if (memchr(buffer + RGI_FILE_HEADER_SIZE + i*RGI_ICON_MAX_NAME_LENGTH, '\0', RGI_ICON_MAX_NAME_LENGTH) == NULL)
+            {
+                RGI_LOG("WARNING: Iconset data not valid, icon name not NULL terminated\n");
+                return 0;
+            }
+        }
+    }
+
+    return count;
+}
+
+// Get valid icons range, clamped to iconset limits
+static int get_icons_range(rgi_iconset iconset, int *first, int count)
+{
+    if (*first < 0) { count += *first; *first = 0; }
+    if ((*first + count) > iconset.count) count = iconset.count - *first;
+
+    return (count > 0)? count : 0;
+}
+
+// Reverse bits order of the two 16 bit rows contained in one data element
+static unsigned int reverse_rows_bits(unsigned int value)
+{
+    value = ((value & 0x55555555) << 1) | ((value >> 1) & 0x55555555);
+    value = ((value & 0x33333333) << 2) | ((value >> 2) & 0x33333333);
+    value = ((value & 0x0f0f0f0f) << 4) | ((value >> 4) & 0x0f0f0f0f);
+    value = ((value & 0x00ff00ff) << 8) | ((value >> 8) & 0x00ff00ff);
+
+    return value;
+}
+
+// Get icon row bits from image pixels (1-4 channels, 8bit), bit x is pixel x
+// NOTE: Pixel is considered set if first channel (and alpha, if available) is bright (>= 128)
+static unsigned short threshold_icon_row(const unsigned char *pixels, int channels)
+{
+    unsigned short row = 0;
+
+    if (channels == 1)
+    {
+        // Full row thresholded at once, pixel is set if byte MSB is set (>= 128)
+    #if defined(RGI_SIMD_SSE2)
+        row = (unsigned short)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)pixels));
+    #else
+        for (int x = 0; x < RGI_ICON_SIZE; x++) row |= (unsigned short)((pixels[x] >> 7) << x);
+    #endif
+    }
+    else
+    {
+        for (int x = 0; x < RGI_ICON_SIZE; x++)
+        {
+            const unsigned char *pixel = pixels + x*channels;
+            bool alpha = ((channels == 2) || (channels == 4))? (pixel[channels - 1] >= 128) : true;
+
+            if (alpha && (pixel[0] >= 128)) row |= (1u << x);
+        }
+    }
+
+    return row;
+}
+
+// Find icon by name id, name not NULL terminated (length provided), -1 if not found
+static int find_icon_by_name(rgi_iconset iconset, const char *name, int length)
+{
+    if ((iconset.names == NULL) || (length <= 0) || (length >= RGI_ICON_MAX_NAME_LENGTH)) return -1;
+
+    for (int i = 0; i < iconset.count; i++)
+    {
+        const char *iconName = &iconset.names[i*RGI_ICON_MAX_NAME_LENGTH];
+
+        if ((iconName[0] == name[0]) && (iconName[length] == '\0') && (memcmp(iconName, name, length) == 0)) return i;
+    }
+
+    return -1;
+}
+
+// Get atlas size and scales sections offset (offsets array, scale_count elements)
+// NOTE: Atlas width fits RGI_ATLAS_ICONS_PER_LINE icons of the biggest scale, every scale section
+// places as many icons per line as fit in atlas width, returns false if scales are not valid
+static bool get_atlas_layout(int count, const int *scales, int scale_count, int padding, int *width, int *height, int *offsets)
+{
+    if ((count <= 0) || (scales == NULL) || (scale_count <= 0) || (scale_count > RGI_ATLAS_MAX_SCALES) || (padding < 0)) return false;
+
+    int maxScale = 0;
+
+    for (int s = 0; s < scale_count; s++)
+    {
+        if ((scales[s] < 1) || (scales[s] > RGI_ATLAS_MAX_SCALE)) return false;
+        if (scales[s] > maxScale) maxScale = scales[s];
+    }
+
+    *width = RGI_ATLAS_ICONS_PER_LINE*(RGI_ICON_SIZE*maxScale + 2*padding);
+    *height = 0;
+
+    for (int s = 0; s < scale_count; s++)
+    {
+        int cell = RGI_ICON_SIZE*scales[s] + 2*padding;
+        int iconsPerLine = *width/cell;
+
+        offsets[s] = *height;
+        *height += ((count + iconsPerLine - 1)/iconsPerLine)*cell;
+    }
+
+    return true;
+}
+
+// Reserve space at the end of code buffer, capacity grows on demand
+// NOTE: In case of allocation failure, buffer is freed and all following writes are skipped
+static char *code_reserve(rgi_code_buffer *code, int size)
+{
+    if (code->capacity < 0) return NULL;
+
+    // NOTE: One extra byte always available for NULL terminator
+    if (code->length + size + 1 > code->capacity)
+    {
+        int capacity = (code->capacity > 0)? code->capacity*2 : 1024;
+        while (code->length + size + 1 > capacity) capacity *= 2;
+
+        char *text = (char *)RGI_REALLOC(code->text, capacity);
+
+        if (text == NULL)
+        {
+            RGI_FREE(code->text);
+            code->text = NULL;
+            code->length = 0;
+            code->capacity = -1;
+            return NULL;
+        }
+
+        code->text = text;
+        code->capacity = capacity;
+    }
+
+    return code->text + code->length;
+}
+
+// Append text to code buffer
+static void code_append(rgi_code_buffer *code, const char *text)
+{
+    int length = (int)strlen(text);
+    char *dst = code_reserve(code, length);
+
+    if (dst != NULL)
+    {
+        memcpy(dst, text, length);
+        code->length += length;
+    }
+}
+
+// Append text to code buffer, padded with spaces up to width
+static void code_append_padded(rgi_code_buffer *code, const char *text, int width)
+{
+    int length = (int)strlen(text);
+    int padding = (length < width)? (width - length) : 0;
+    char *dst = code_reserve(code, length + padding);
+
+    if (dst != NULL)
+    {
+        memcpy(dst, text, length);
+        memset(dst + length, ' ', padding);
+        code->length += length + padding;
+    }
+}
+
+// Append integer value to code buffer (decimal), zero padded up to digits
+static void code_append_int(rgi_code_buffer *code, int value, int digits)
+{
+    char buffer[16] = { 0 };
+    int length = 0;
+    unsigned int number = (value < 0)? (0u - (unsigned int)value) : (unsigned int)value;
+
+    // Digits written in reverse order
+    do
+    {
+        buffer[length++] = (char)('0' + number%10);
+        number /= 10;
+    } while ((number > 0) || (length < digits));
+
+    if (value < 0) buffer[length++] = '-';
+
+    char *dst = code_reserve(code, length);
+
+    if (dst != NULL)
+    {
+        for (int i = 0; i < length; i++) dst[i] = buffer[length - 1 - i];
+        code->length += length;
+    }
+}
+
+// Append integer value to code buffer, right aligned, padded with spaces up to width
+static void code_append_int_padded(rgi_code_buffer *code, int value, int width)
+{
+    int length = (value < 0)? 2 : 1;
+    for (int number = (value < 0)? -value : value; number >= 10; number /= 10) length++;
+
+    for (int i = length; i < width; i++) code_append(code, " ");
+    code_append_int(code, value, 0);
+}
+
+// Append value/size to code buffer as float literal, 6 decimals (rounded), value must be in [0..size]
+// NOTE: Computed with integers, no locale dependant formatting
+static void code_append_ratio(rgi_code_buffer *code, int value, int size)
+{
+    long long scaled = ((long long)value*2000000/size + 1)/2;
+
+    code_append_int(code, (int)(scaled/1000000), 0);
+    code_append(code, ".");
+    code_append_int(code, (int)(scaled%1000000), 6);
+    code_append(code, "f");
+}
+
+// Append value to code buffer as hexadecimal (0x prefix, lowercase), digits: 2 (byte) or 8 (32bit)
+static void code_append_hex(rgi_code_buffer *code, unsigned int value, int digits)
+{
+    static const char hex[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+    char *dst = code_reserve(code, digits + 2);
+
+    if (dst != NULL)
+    {
+        dst[0] = '0';
+        dst[1] = 'x';
+        for (int i = 0; i < digits; i++) dst[2 + i] = hex[(value >> (4*(digits - 1 - i))) & 0x0f];
+        code->length += digits + 2;
+    }
+}
+
+// Append icon name id to code buffer, icons without name use their index as name: ICON_000
+static void code_append_icon_name(rgi_code_buffer *code, rgi_iconset iconset, int id, int width)
+{
+    const char *name = rgi_get_icon_name(iconset, id);
+    char buffer[RGI_ICON_MAX_NAME_LENGTH + 8] = "ICON_";
+
+    if ((name != NULL) && (name[0] != '\0')) strncpy(buffer + 5, name, RGI_ICON_MAX_NAME_LENGTH);
+    else
+    {
+        // NOTE: Index formatted as %03i, up to 4 digits
+        int length = (id >= 1000)? 4 : 3;
+        for (int i = length - 1, value = id; i >= 0; i--, value /= 10) buffer[5 + i] = (char)('0' + value%10);
+    }
+
+    code_append_padded(code, buffer, width);
+}
+
+// Append code file header: exporter info banner, layout described
+static void code_append_banner(rgi_code_buffer *code, const char *layout)
+{
+    code_append(code, "//////////////////////////////////////////////////////////////////////////////////\n");
+    code_append(code, "//                                                                              //\n");
+    code_append(code, "// raygui Icons exporter v1.1 - ");
+    code_append_padded(code, layout, 48);
+    code_append(code, "//\n");
+    code_append(code, "//                                                                              //\n");
+    code_append(code, "// more info and bugs-report:  github.com/raysan5/raygui                        //\n");
+    code_append(code, "// feedback and support:       ray[at]raylibtech.com                            //\n");
+    code_append(code, "//                                                                              //\n");
+    code_append(code, "// Copyright (c) 2019-2026 raylib technologies (@raylibtech)                    //\n");
+    code_append(code, "//                                                                              //\n");
+    code_append(code, "//////////////////////////////////////////////////////////////////////////////////\n\n");
+}
+
+// Append code section separator, with section title
+static void code_append_section(rgi_code_buffer *code, const char *title)
+{
+    code_append(code, "//----------------------------------------------------------------------------------\n// ");
+    code_append(code, title);
+    code_append(code, "\n//----------------------------------------------------------------------------------\n");
+}
+
+// Append icons defines (raygui compatible) and icons enumeration
+static void code_append_defines_enum(rgi_code_buffer *code, rgi_iconset iconset)
+{
+    code_append_section(code, "Defines and Macros");
+    code_append(code, "#define RAYGUI_ICON_SIZE             ");
+    code_append_int(code, RGI_ICON_SIZE, 0);
+    code_append(code, "   // Size of icons (squared)\n#define RAYGUI_ICON_MAX_ICONS       ");
+    code_append_int(code, iconset.count, 0);
+    code_append(code, "   // Maximum number of icons\n#define RAYGUI_ICON_MAX_NAME_LENGTH  ");
+    code_append_int(code, RGI_ICON_MAX_NAME_LENGTH, 0);
+    code_append(code, "   // Maximum length of icon name id\n\n");
+
+    code_append(code, "// Icons data is defined by bit array (every bit represents one pixel)\n");
+    code_append(code, "// Those arrays are stored as unsigned int data arrays, so every array\n");
+    code_append(code, "// element defines 32 pixels (bits) of information\n");
+    code_append(code, "// Number of elemens depend on RAYGUI_ICON_SIZE (by default 16x16 pixels)\n");
+    code_append(code, "#define RAYGUI_ICON_DATA_ELEMENTS   (RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE/32)\n\n");
+
+    code_append_section(code, "Icons enumeration");
+    code_append(code, "typedef enum {\n");
+    for (int i = 0; i < iconset.count; i++)
+    {
+        code_append(code, "    ");
+        code_append_icon_name(code, iconset, i, 29);
+        code_append(code, " = ");
+        code_append_int(code, i, 0);
+        code_append(code, ",\n");
+    }
+    code_append(code, "} guiIconName;\n\n");
+}
+
+// Append icons data values, one icon per line, icon name id commented
+static void code_append_icons_values(rgi_code_buffer *code, rgi_iconset iconset, const char *comment)
+{
+    for (int i = 0; i < iconset.count; i++)
+    {
+        const unsigned int *icon = rgi_get_icon_view(iconset, i);
+
+        code_append(code, "    ");
+        for (int j = 0; j < RGI_ICON_DATA_ELEMENTS; j++)
+        {
+            code_append_hex(code, icon[j], 8);
+            code_append(code, ", ");
+        }
+
+        code_append(code, comment);
+        code_append_icon_name(code, iconset, i, 0);
+        code_append(code, "\n");
+    }
+}
+
+// Code formatter: C layout, icons enum and data array (raygui compatible)
+static void format_code_c(rgi_code_buffer *code, rgi_iconset iconset)
+{
+    code_append_banner(code, "Icons data exported as a values array");
+    code_append_defines_enum(code, iconset);
+
+    code_append_section(code, "Icons data");
+    code_append(code, "static unsigned int guiIcons[RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS] = {\n");
+    code_append_icons_values(code, iconset, "     // ");
+    code_append(code, "};\n\n");
+
+    code_append(code, "// NOTE: A pointer to the current icons array should be defined\n");
+    code_append(code, "static unsigned int *guiIconsPtr = guiIcons;\n");
+}
+
+// Code formatter: C++17 layout, constants, icons enum, constexpr data array (read-only) and name ids lookup
+// NOTE: Declarations placed into raygui::icons namespace, no icons macros defined, no conflicts with raygui.h,
+// name ids lookup uses a perfect hash table, so names are resolved at compile time when constant
+static void format_code_cpp(rgi_code_buffer *code, rgi_iconset iconset)
+{
+    code_append_banner(code, "Icons data exported as C++17 constexpr");
+    code_append(code, "#pragma once\n\n");
+    code_append(code, "#include <cstdint>\n");
+    code_append(code, "#include <string_view>\n\n");
+    code_append(code, "// Compile time only helpers are consteval if supported (C++20), constexpr otherwise\n");
+    code_append(code, "#if !defined(RAYGUI_ICONS_CONSTEVAL)\n");
+    code_append(code, "    #if defined(__cpp_consteval)\n");
+    code_append(code, "        #define RAYGUI_ICONS_CONSTEVAL consteval\n");
+    code_append(code, "    #else\n");
+    code_append(code, "        #define RAYGUI_ICONS_CONSTEVAL constexpr\n");
+    code_append(code, "    #endif\n");
+    code_append(code, "#endif\n\n");
+    code_append(code, "namespace raygui::icons {\n\n");
+
+    code_append_section(code, "Constants");
+    code_append(code, "inline constexpr int ICON_SIZE = ");
+    code_append_int(code, RGI_ICON_SIZE, 0);
+    code_append(code, ";                 // Size of icons (squared)\ninline constexpr int ICON_MAX_ICONS = ");
+    code_append_int(code, iconset.count, 0);
+    code_append(code, ";           // Number of icons\ninline constexpr int ICON_MAX_NAME_LENGTH = ");
+    code_append_int(code, RGI_ICON_MAX_NAME_LENGTH, 0);
+    code_append(code, ";      // Maximum length of icon name id\n");
+    code_append(code, "inline constexpr int ICON_DATA_ELEMENTS = ICON_SIZE*ICON_SIZE/32;  // Data elements per icon (32 pixels each)\n\n");
+
+    code_append_section(code, "Icons enumeration");
+    code_append(code, "enum guiIconName : int {\n");
+    for (int i = 0; i < iconset.count; i++)
+    {
+        code_append(code, "    ");
+        code_append_icon_name(code, iconset, i, 29);
+        code_append(code, " = ");
+        code_append_int(code, i, 0);
+        code_append(code, ",\n");
+    }
+    code_append(code, "};\n\n");
+
+    code_append_section(code, "Icons data");
+    code_append(code, "inline constexpr std::uint32_t guiIcons[ICON_MAX_ICONS*ICON_DATA_ELEMENTS] = {\n");
+    code_append_icons_values(code, iconset, "     // ");
+    code_append(code, "};\n\n");
+
+    // Icons name ids and perfect hash tables for name lookup
+    int bucket_count = 0;
+    int slot_count = 0;
+    unsigned short *seeds = (unsigned short *)RGI_CALLOC(iconset.count/4 + 1, sizeof(unsigned short));
+    short *slots = (short *)RGI_CALLOC(iconset.count*3 + 1, sizeof(short));
+
+    if ((seeds == NULL) || (slots == NULL) || !build_names_hash(iconset, seeds, slots, &bucket_count, &slot_count))
+    {
+        // NOTE: Code buffer freed, export failed
+        RGI_FREE(seeds);
+        RGI_FREE(slots);
+        RGI_FREE(code->text);
+        code->text = NULL;
+        code->capacity = -1;
+        return;
+    }
+
+    code_append(code, "// Icons name ids (without ICON_ prefix), empty for icons without name\n");
+    code_append(code, "inline constexpr std::string_view guiIconsName[ICON_MAX_ICONS] = {\n");
+    for (int i = 0; i < iconset.count; i++)
+    {
+        const char *name = rgi_get_icon_name(iconset, i);
+
+        code_append(code, "    ");
+        code_append_string(code, (name != NULL)? name : "");
+        code_append(code, ",\n");
+    }
+    code_append(code, "};\n\n");
+
+    code_append_section(code, "Icons name lookup: perfect hash (CHD), names hashed into buckets,\n// every bucket seed places its names into distinct slots, no collisions");
+    code_append(code, "inline constexpr int ICON_HASH_BUCKETS = ");
+    code_append_int(code, bucket_count, 0);
+    code_append(code, ";\ninline constexpr int ICON_HASH_SLOTS = ");
+    code_append_int(code, slot_count, 0);
+    code_append(code, ";\n\n");
+
+    code_append(code, "inline constexpr std::uint16_t guiIconsHashSeeds[ICON_HASH_BUCKETS] = {");
+    for (int i = 0; i < bucket_count; i++)
+    {
+        code_append(code, ((i%16) == 0)? "\n    " : " ");
+        code_append_int(code, seeds[i], 0);
+        code_append(code, ",");
+    }
+    code_append(code, "\n};\n\n");
+
+    code_append(code, "// Icon id for every slot, -1 for empty slots\n");
+    code_append(code, "inline constexpr std::int16_t guiIconsHashSlots[ICON_HASH_SLOTS] = {");
+    for (int i = 0; i < slot_count; i++)
+    {
+        code_append(code, ((i%16) == 0)? "\n    " : " ");
+        code_append_int(code, slots[i], 0);
+        code_append(code, ",");
+    }
+    code_append(code, "\n};\n\n");
+
+    RGI_FREE(seeds);
+    RGI_FREE(slots);
+
+    code_append_section(code, "Icons helpers, constexpr");
+    code_append(code,
+        "// Icon name hash: FNV-1a (seeded) with final avalanche mix\n"
+        "constexpr std::uint32_t IconNameHash(std::string_view name, std::uint32_t seed)\n"
+        "{\n"
+        "    std::uint32_t hash = 2166136261u ^ (seed*0x9e3779b9u);\n"
+        "\n"
+        "    for (char c : name)\n"
+        "    {\n"
+        "        hash ^= static_cast<unsigned char>(c);\n"
+        "        hash *= 16777619u;\n"
+        "    }\n"
+        "\n"
+        "    hash ^= hash >> 16;\n"
+        "    hash *= 0x85ebca6bu;\n"
+        "    hash ^= hash >> 13;\n"
+        "    hash *= 0xc2b2ae35u;\n"
+        "    hash ^= hash >> 16;\n"
+        "\n"
+        "    return hash;\n"
+        "}\n"
+        "\n"
+        "// Get icon id from name id (without ICON_ prefix), -1 if not found\n"
+        "// NOTE: Perfect hash lookup, one name compared, resolved at compile time if name is constant\n"
+        "constexpr int GetIconId(std::string_view name)\n"
+        "{\n"
+        "    std::uint32_t bucket = IconNameHash(name, 0)%ICON_HASH_BUCKETS;\n"
+        "    int id = guiIconsHashSlots[IconNameHash(name, guiIconsHashSeeds[bucket])%ICON_HASH_SLOTS];\n"
+        "\n"
+        "    return ((id >= 0) && !name.empty() && (guiIconsName[id] == name))? id : -1;\n"
+        "}\n"
+        "\n"
+        "// Get icon name id (without ICON_ prefix), empty if icon has no name or id is not valid\n"
+        "constexpr std::string_view GetIconName(int id)\n"
+        "{\n"
+        "    return ((id >= 0) && (id < ICON_MAX_ICONS))? guiIconsName[id] : std::string_view();\n"
+        "}\n"
+        "\n"
+        "// Check icon pixel, resolved at compile time if arguments are constant\n"
+        "constexpr bool IsIconPixelSet(int id, int x, int y)\n"
+        "{\n"
+        "    return (guiIcons[id*ICON_DATA_ELEMENTS + (y*ICON_SIZE + x)/32] >> ((y*ICON_SIZE + x)%32)) & 1u;\n"
+        "}\n"
+        "\n"
+        "// Icon name not found, not a constant expression: compilation fails if called on IconId() evaluation\n"
+        "inline int IconNameNotFound() { return -1; }\n"
+        "\n"
+        "// Get icon id from name id at compile time, compilation fails if name is not found\n"
+        "// NOTE: consteval requires C++20, on C++17 it is constexpr and must be used in constant expressions\n"
+        "RAYGUI_ICONS_CONSTEVAL int IconId(std::string_view name)\n"
+        "{\n"
+        "    return (GetIconId(name) >= 0)? GetIconId(name) : IconNameNotFound();\n"
+        "}\n");
+    code_append(code, "\n} // namespace raygui::icons\n");
+}
+
+// Code formatter: C layout, icons enum and iconset file data (.rgi) as a compressed blob
+// NOTE: Blob compressed with PackBits (RLE), names and empty icons data compress well,
+// unpacking function is included, data must be loaded with GuiLoadIconsFromMemory()
+static void format_code_blob(rgi_code_buffer *code, rgi_iconset iconset)
+{
+    int size = 0;
+    unsigned char *data = rgi_save_iconset_to_memory(iconset, &size);
+    unsigned char *blob = (data != NULL)? (unsigned char *)RGI_MALLOC(size + size/128 + 1) : NULL;
+
+    if (blob == NULL)
+    {
+        // NOTE: Code buffer freed, export failed
+        RGI_FREE(data);
+        RGI_FREE(code->text);
+        code->text = NULL;
+        code->capacity = -1;
+        return;
+    }
+
+    int blob_size = pack_bits(data, size, blob);
+
+    code_append_banner(code, "Icons data exported as a compressed blob");
+    code_append_defines_enum(code, iconset);
+
+    code_append_section(code, "Icons data");
+    code_append(code, "#define GUI_ICONS_FILE_SIZE    ");
+    code_append_int(code, size, 0);
+    code_append(code, "   // Iconset file data size (.rgi), unpacked\n#define GUI_ICONS_BLOB_SIZE    ");
+    code_append_int(code, blob_size, 0);
+    code_append(code, "   // Iconset blob size, PackBits compressed\n\n");
+
+    code_append(code, "static const unsigned char guiIconsBlob[GUI_ICONS_BLOB_SIZE] = {");
+    for (int i = 0; i < blob_size; i++)
+    {
+        code_append(code, ((i%16) == 0)? "\n    " : " ");
+        code_append_hex(code, blob[i], 2);
+        code_append(code, ",");
+    }
+    code_append(code, "\n};\n\n");
+
+    code_append(code, "// Unpack icons blob into iconset file data (.rgi), output must be GUI_ICONS_FILE_SIZE bytes\n");
+    code_append(code, "// NOTE: Control byte n < 128 copies n + 1 bytes, n > 128 repeats next byte 257 - n times,\n");
+    code_append(code, "// unpacked data can be loaded with: GuiLoadIconsFromMemory(data, GUI_ICONS_FILE_SIZE, true)\n");
+    code_append(code, "static int GuiUnpackIconsBlob(unsigned char *output)\n");
+    code_append(code, "{\n");
+    code_append(code, "    int size = 0;\n\n");
+    code_append(code, "    for (int i = 0; i < GUI_ICONS_BLOB_SIZE;)\n");
+    code_append(code, "    {\n");
+    code_append(code, "        int n = guiIconsBlob[i++];\n\n");
+    code_append(code, "        if (n < 128) for (int k = 0; k <= n; k++) output[size++] = guiIconsBlob[i++];\n");
+    code_append(code, "        else if (n > 128)\n");
+    code_append(code, "        {\n");
+    code_append(code, "            for (int k = 0; k < 257 - n; k++) output[size++] = guiIconsBlob[i];\n");
+    code_append(code, "            i++;\n");
+    code_append(code, "        }\n");
+    code_append(code, "    }\n\n");
+    code_append(code, "    return size;\n");
+    code_append(code, "}\n");
+
+    RGI_FREE(blob);
+    RGI_FREE(data);
+}
+
+// Append text to code buffer as a string literal, quotes, backslashes and control characters escaped
+static void code_append_string(rgi_code_buffer *code, const char *text)
+{
+    int length = (int)strlen(text);
+    char *dst = code_reserve(code, length*4 + 2);     // NOTE: Worst case, all characters escaped as octal
+
+    if (dst != NULL)
+    {
+        int k = 0;
+        dst[k++] = '"';
+
+        for (int i = 0; i < length; i++)
+        {
+            unsigned char c = (unsigned char)text[i];
+
+            if ((c == '"') || (c == '\\'))
+            {
+                dst[k++] = '\\';
+                dst[k++] = (char)c;
+            }
+            else if (c < 0x20)
+            {
+                dst[k++] = '\\';
+                dst[k++] = (char)('0' + ((c >> 6) & 7));
+                dst[k++] = (char)('0' + ((c >> 3) & 7));
+                dst[k++] = (char)('0' + (c & 7));
+            }
+            else dst[k++] = (char)c;
+        }
+
+        dst[k++] = '"';
+        code->length += k;
+    }
+}
+
+// Icon name hash: FNV-1a (seeded) with final avalanche mix
+// NOTE: Same hash is generated as constexpr function on C++ code export, both must match
+static unsigned int hash_icon_name(const char *name, unsigned int seed)
+{
+    unsigned int hash = 2166136261u ^ (seed*0x9e3779b9u);
+
+    for (int i = 0; name[i] != '\0'; i++)
+    {
+        hash ^= (unsigned char)name[i];
+        hash *= 16777619u;
+    }
+
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bu;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35u;
+    hash ^= hash >> 16;
+
+    return hash;
+}
+
+// Build icons names perfect hash (CHD: compress, hash and displace)
+// NOTE: Names are hashed into buckets (~4 names per bucket), buckets are placed biggest first,
+// searching a seed that places all bucket names into free slots, slots increased if no seed found,
+// seeds must fit (count/4 + 1) elements and slots (count*3 + 1) elements, duplicated names skipped
+static bool build_names_hash(rgi_iconset iconset, unsigned short *seeds, short *slots, int *bucket_count, int *slot_count)
+{
+    int *keys = (int *)RGI_CALLOC(iconset.count + 1, sizeof(int));          // Icons ids with unique name
+    int *buckets = (int *)RGI_CALLOC(iconset.count + 1, sizeof(int));       // Bucket for every key
+    int *order = (int *)RGI_CALLOC(iconset.count/4 + 1, sizeof(int));       // Buckets placement order
+    int *sizes = (int *)RGI_CALLOC(iconset.count/4 + 1, sizeof(int));       // Buckets sizes
+    bool result = false;
+
+    if ((keys == NULL) || (buckets == NULL) || (order == NULL) || (sizes == NULL))
+    {
+        RGI_FREE(keys);
+        RGI_FREE(buckets);
+        RGI_FREE(order);
+        RGI_FREE(sizes);
+        return false;
+    }
+
+    int key_count = 0;
+    for (int i = 0; i < iconset.count; i++)
+    {
+        const char *name = rgi_get_icon_name(iconset, i);
+        if ((name == NULL) || (name[0] == '\0')) continue;
+
+        bool duplicated = false;
+        for (int k = 0; (k < key_count) && !duplicated; k++) duplicated = (strcmp(rgi_get_icon_name(iconset, keys[k]), name) == 0);
+
+        if (!duplicated) keys[key_count++] = i;
+    }
+
+    int bucket_total = key_count/4 + 1;
+
+    for (int k = 0; k < key_count; k++)
+    {
+        buckets[k] = (int)(hash_icon_name(rgi_get_icon_name(iconset, keys[k]), 0)%(unsigned int)bucket_total);
+        sizes[buckets[k]]++;
+    }
+
+    // Buckets sorted by size, biggest first (insertion sort)
+    for (int b = 0; b < bucket_total; b++)
+    {
+        int n = b;
+        for (; (n > 0) && (sizes[order[n - 1]] < sizes[b]); n--) order[n] = order[n - 1];
+        order[n] = b;
+    }
+
+    // Slots increased on every attempt: load factor from 0.8 to 0.33
+    for (int attempt = 0; (attempt < 8) && !result; attempt++)
+    {
+        int slot_total = key_count + (key_count*(attempt + 1))/4 + 1;
+        if (slot_total > iconset.count*3 + 1) slot_total = iconset.count*3 + 1;
+
+        for (int s = 0; s < slot_total; s++) slots[s] = -1;
+        memset(seeds, 0, bucket_total*sizeof(unsigned short));
+
+        result = true;
+
+        for (int i = 0; (i < bucket_total) && result && (sizes[order[i]] > 0); i++)
+        {
+            int b = order[i];
+            int placed[64] = { 0 };
+            int placed_count = 0;
+
+            result = false;
+            if (sizes[b] > 64) break;
+
+            // NOTE: Seed 0 is used for buckets hash, bucket seeds start at 1
+            for (unsigned int seed = 1; (seed < 65536) && !result; seed++)
+            {
+                placed_count = 0;
+                result = true;
+
+                for (int k = 0; (k < key_count) && result; k++)
+                {
+                    if (buckets[k] != b) continue;
+
+                    int slot = (int)(hash_icon_name(rgi_get_icon_name(iconset, keys[k]), seed)%(unsigned int)slot_total);
+
+                    if (slots[slot] != -1) result = false;
+                    for (int p = 0; (p < placed_count) && result; p++) if (placed[p] == slot) result = false;
+
+                    if (result) placed[placed_count++] = slot;
+                }
+
+                if (result)
+                {
+                    // Bucket names placed, keys order is the same on placement
+                    for (int k = 0, p = 0; k < key_count; k++) if (buckets[k] == b) slots[placed[p++]] = (short)keys[k];
+                    seeds[b] = (unsigned short)seed;
+                }
+            }
+        }
+
+        *bucket_count = bucket_total;
+        *slot_count = slot_total;
+    }
+
+    RGI_FREE(keys);
+    RGI_FREE(buckets);
+    RGI_FREE(order);
+    RGI_FREE(sizes);
+
+    return result;
+}
+
+// Compress data with PackBits (RLE), output must be (size + size/128 + 1) bytes at least
+// NOTE: Runs of 3 or more bytes are encoded as (257 - count, byte), other bytes as literals (count - 1, bytes)
+static int pack_bits(const unsigned char *data, int size, unsigned char *output)
+{
+    int i = 0;
+    int output_size = 0;
+
+    while (i < size)
+    {
+        int run = 1;
+        while ((i + run < size) && (run < 128) && (data[i + run] == data[i])) run++;
+
+        if (run >= 3)
+        {
+            output[output_size++] = (unsigned char)(257 - run);
+            output[output_size++] = data[i];
+            i += run;
+        }
+        else
+        {
+            // Literal bytes up to next run (3 bytes at least) or 128 bytes
+            int start = i;
+            int count = 0;
+
+            while ((i < size) && (count < 128))
+            {
+                if ((i + 2 < size) && (data[i] == data[i + 1]) && (data[i] == data[i + 2])) break;
+                i++;
+                count++;
+            }
+
+            output[output_size++] = (unsigned char)(count - 1);
+            memcpy(output + output_size, data + start, count);
+            output_size += count;
+        }
+    }
+
+    return output_size;
+}
+
+// Transpose icon bits matrix (16x16), rows provided as 16 bit values
+// NOTE: Blocks swap transpose (8x8, 4x4, 2x2, 1x1), every step swaps the
+// off-diagonal blocks of all rows pairs using masks, instead of moving bits one by one
+static void transpose_icon_rows(unsigned short *rows)
+{
+    static const unsigned short masks[4] = { 0x00ff, 0x0f0f, 0x3333, 0x5555 };
+
+    for (int j = 8, m = 0; j > 0; j >>= 1, m++)
+    {
+        for (int k = 0; k < RGI_ICON_SIZE; k = ((k + j + 1) & ~j))
+        {
+            unsigned short t = ((rows[k] >> j) ^ rows[k + j]) & masks[m];
+            rows[k + j] ^= t;
+            rows[k] ^= (t << j);
+        }
+    }
+}
+
+#endif // RGI_IMPLEMENTATION
@@ -6,7 +6,7 @@
 *       - Icon editing and preview at multiple sizes
 *       - Cut, copy, paste icons for easy editing
 *       - Undo/Redo system for icon changes
-*       - Edit icon tools: flip and rotate
+*       - Edit icon tools: flip, rotate, shift and invert
 *       - Define icon name (up to 32 characters)
 *       - Save and load as binary iconset file .rgi
 *       - Export iconset as an embeddable code file (.h)
@@ -33,11 +33,32 @@
 *                           ADDED: New icon edit tools: flipH, flipV, rotate
 *                           ADDED: Button to reload default raygui icon set
 *                           ADDED: Icon hex view, with button to copy to clipboard
+*                           ADDED: Idle mode, screen only redrawn on changes (--fps-stats)
+*                           ADDED: New icon edit tools: rotate 180/270, shift, invert
+*                           ADDED: Headless iconsets library rgi.h (librgi), no raylib required
+*                           ADDED: Command line batch mode: multiple inputs, output directory, workers
+*                           ADDED: Command line output to stdout (--output -)
+*                           ADDED: Icons image loading (.png drag & drop), icons name ids recovered
+*                           ADDED: PNG export compression profiles: fast, default, max (--compression)
+*                           ADDED: Command line conversion stats: encode time and output size (--stats)
+*                           ADDED: PNG export multithreaded compression, big images only (--png-threads)
+*                           ADDED: Icons image loading streamed, rows decoded and thresholded one by one
+*                           ADDED: Code export layouts: C array, C++17 constexpr, compressed blob (--code-format)
+*                           ADDED: Iconset trimming to icons used by sources, remap table exported (--trim)
+*                           ADDED: Icons atlas export, pre-rasterized at several scales with icons UVs (--atlas)
+*                           REVIEWED: Iconset files loading, memory mapped and validated, no leaks
+*                           REVIEWED: Iconset files saving, atomic and direct download from memory on web
+*                           REVIEWED: PNG export, image and icons name ids chunk written in one pass
+*                           REVIEWED: PNG export as 1bit grayscale, packed directly from icons data
+*                           REVIEWED: PNG scanlines filters selection, vectorized (--png-filter)
 *                           REVIEWED: New button creates and empty icon set
 *                           REVIEWED: Main toolbar to add buttons for edit options
 *                           REVIEWED: Status bar to show more info
 *                           REVIEWED: Added new UI styles: Amber, Genesis
 *                           REVIEWED: Full UI to accomodate more icons
+*                           REVIEWED: Icons drawing using a texture atlas, updated on changes
+*                           REVIEWED: Icons selection panel cached, only redrawn on changes
+*                           REVIEWED: Undo/Redo system, icon changes journal with memory budget
 *                           UPDATED: Using raylib 6.1-dev and raygui 5.0-dev
 *
 *       3.1  (06-Apr-2024)  ADDED: Report Issue/Features window (Open GitHub)
@@ -77,7 +98,8 @@
 *   DEPENDENCIES:
 *       raylib 6.0              - Windowing/input management and drawing
 *       raygui 5.0              - Immediate-mode GUI controls with custom styling and icons
-*       rpng 1.5                - PNG chunks management
+*       rpng 1.6                - PNG chunks management
+*       rgi 1.0                 - raygui iconsets management (load/save/export, transforms)
 *       tinyfiledialogs 3.20    - Open/save file dialogs, it requires linkage with comdlg32 and ole32 libs
 *
 *   BUILDING:
@@ -167,14 +189,44 @@
 #include "styles/style_amber.h"             // raygui style: amber
 #include "styles/style_genesis.h"           // raygui style: genesis
 
+// PNG image data compressed by multiple threads, not available on MSVC (no pthreads)
+#if defined(PLATFORM_DESKTOP) && !defined(_MSC_VER)
+    #define RPNG_THREADS
+#endif
 #define RPNG_IMPLEMENTATION
 #include "external/rpng.h"                  // PNG chunks management
 
+// NOTE: rgi is a headless library (no raylib required), using raylib allocators
+// to allow freeing generated data with raylib functions (i.e. UnloadImage())
+#define RGI_MALLOC(sz)      RL_MALLOC(sz)
+#define RGI_CALLOC(n,sz)    RL_CALLOC(n,sz)
+#define RGI_REALLOC(p,sz)   RL_REALLOC(p,sz)
+#define RGI_FREE(p)         RL_FREE(p)
+#define RGI_IMPLEMENTATION
+#include "rgi.h"                            // raygui iconsets management: load/save/export, transforms
+
 #include <stdio.h>                          // Required for: fopen(), fclose(), fread()...
 #include <stdlib.h>                         // Required for: malloc(), free()
 #include <string.h>                         // Required for: strcmp(), strlen()
 #include <stdio.h>                          // Required for: FILE, fopen(), fread(), fwrite(), ftell(), fseek() fclose()
 
+// Command line batch mode worker threads, not available on MSVC (sequential processing)
+#if defined(PLATFORM_DESKTOP) && !defined(_MSC_VER)
+    #define SUPPORT_BATCH_WORKERS
+    #include <pthread.h>                    // Required for: pthread_create(), pthread_join(), pthread_mutex_lock()...
+#endif
+
+// Command line conversion stats requires a wall clock timer
+#if defined(PLATFORM_DESKTOP)
+    #include <time.h>                       // Required for: clock_gettime(), clock()
+#endif
+
+// Command line output to stdout requires binary mode on Windows
+#if defined(PLATFORM_DESKTOP) && defined(_WIN32)
+    #include <io.h>                         // Required for: _setmode(), _fileno()
+    #include <fcntl.h>                      // Required for: _O_BINARY
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -191,11 +243,20 @@ bool __stdcall FreeConsole(void);       // Close console from code (kernel32.lib
     #define LOG(...)
 #endif
 
-#define RGI_BIT_CHECK(a,b)  ((a) &  (1u<<(b)))
-#define RGI_BIT_SET(a,b)    ((a) |= (1u<<(b)))
-#define RGI_BIT_CLEAR(a,b)  ((a) &= ~((1u)<<(b)))
+#define UNDO_MEMORY_BUDGET      (256*1024)  // Undo journal default memory budget (in bytes), oldest steps dropped when exceeded
+
+#define IDLE_REDRAW_FRAMES      3       // Frames redrawn after last detected change (some GUI changes are applied on next frame)
+
+#define MAX_BATCH_WORKERS       64      // Maximum number of command line batch mode workers
+
+// PNG export compression profiles, deflate compression levels
+#define COMPRESSION_LEVEL_FAST      1                           // Fast: interactive saves, iteration builds
+#define COMPRESSION_LEVEL_DEFAULT   5                           // Default: balanced speed/size
+#define COMPRESSION_LEVEL_MAX       RPNG_COMPRESSION_LEVEL_MAX  // Max: smallest output, release artifacts
 
-#define MAX_UNDO_LEVELS         10      // Undo levels supported for the ring buffer
+#define PNG_EXPORT_THREADS      4       // PNG export compression threads (only used for big images, i.e. upscaled sheets)
+
+#define ATLAS_CELL_PADDING      1       // Icons atlas cells padding (in pixels), avoids bleeding of neighbour icons on filtering
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -212,13 +273,135 @@ typedef struct GuiIcon {
 } GuiIcon;
 */
 
-// Full icons set
-// NOTE: Used for undo/redo system
-typedef struct GuiIconSet {
-    unsigned int count;
-    unsigned int iconSize;
-    unsigned int *values;
-} GuiIconSet;
+// Undo journal icon change
+// NOTE: Change is stored as a XOR delta between the icon state before and after the edit,
+// the same delta is applied to undo or redo the change
+typedef struct UndoIconDelta {
+    int iconId;                                         // Changed icon id
+    unsigned int values[RAYGUI_ICON_DATA_ELEMENTS];     // Icon data XOR delta
+    char name[RAYGUI_ICON_MAX_NAME_LENGTH];             // Icon name XOR delta
+} UndoIconDelta;
+
+// Undo journal step, all icons changed by one edit operation
+typedef struct UndoStep {
+    int count;                  // Number of changed icons
+    UndoIconDelta *deltas;      // Changed icons deltas
+} UndoStep;
+
+// Undo journal
+// NOTE: Icons must be recorded (RecordIconChange()) before being modified, pending changes
+// are committed as a single undo step, only icons that really changed are stored
+typedef struct UndoJournal {
+    UndoStep *steps;            // Recorded steps, oldest first
+    int stepCount;              // Number of recorded steps
+    int stepCapacity;           // Steps array capacity
+    int currentStep;            // Number of steps currently applied (next redo step)
+
+    int memoryUsed;             // Memory used by recorded steps (in bytes)
+    int memoryBudget;           // Memory budget, oldest steps are dropped when exceeded
+
+    int pendingCount;           // Number of icons recorded for next step
+    int *pendingIds;            // Icons recorded for next step
+    bool *pendingMap;           // Icons recorded for next step, indexed by icon id
+    unsigned int *pendingValues; // Icons data before the change, indexed by icon id
+    char *pendingNames;         // Icons name before the change, indexed by icon id
+} UndoJournal;
+
+// Icons atlas texture
+// NOTE: Every icon bit is expanded to one GRAY_ALPHA pixel (white, alpha 0 or 255),
+// so any icon can be drawn at any scale with a single textured quad, tinted with required color
+typedef struct IconsAtlas {
+    Texture2D texture;          // Atlas texture, icons placed in a grid of iconsPerLine
+    int iconCount;              // Number of icons in the atlas
+    int iconsPerLine;           // Number of icons per atlas line
+    unsigned int *values;       // Icons data currently uploaded to texture, used to detect changes
+} IconsAtlas;
+
+// Icons selection panel cache
+// NOTE: Drawing all icons with GuiToggleGroup() requires parsing the full toggles text and
+// drawing every icon pixel-by-pixel, so panel is rendered to a texture and only redrawn on changes
+typedef struct IconsPanelCache {
+    RenderTexture2D target;     // Panel render texture
+    Rectangle bounds;           // Panel bounds on screen
+    bool valid;                 // Panel texture is up to date (set to false to force redraw)
+
+    // Panel state on last redraw
+    int hoverIcon;              // Icon under mouse cursor (-1 if none)
+    bool mouseButtonDown;       // Mouse left button down
+    int selectedIcon;           // Selected icon
+    int visualStyle;            // Active visual style
+    bool locked;                // GUI locked (or some text box in edit mode)
+
+    unsigned int rebuildCount;  // Number of frames panel has been redrawn
+    unsigned int reuseCount;    // Number of frames panel cached texture has been reused
+} IconsPanelCache;
+
+// Icons image loader, image rows thresholded into icons data as decoded (streamed)
+// NOTE: Image info is set by rpng before first row, iconset generated on first row
+typedef struct IconsImageLoader {
+    int width;                  // Image width
+    int height;                 // Image height
+    int channels;               // Image color channels
+    int bitDepth;               // Image bit depth
+    rgi_iconset iconset;        // Iconset loaded
+} IconsImageLoader;
+
+#if defined(PLATFORM_DESKTOP)
+// Command line conversion output format
+typedef enum {
+    OUTPUT_FORMAT_RGI = 0,      // raygui iconset file (.rgi)
+    OUTPUT_FORMAT_PNG,          // Iconset image, icons name ids saved in zTXt chunk (.png)
+    OUTPUT_FORMAT_CODE          // Iconset as code file (.h)
+} OutputFormat;
+
+// Command line icons atlas output format
+typedef enum {
+    ATLAS_FORMAT_NONE = 0,      // No icons atlas exported
+    ATLAS_FORMAT_RAW,           // Icons atlas raw data, 8bit single channel (.raw)
+    ATLAS_FORMAT_PNG            // Icons atlas image, 8bit grayscale (.png)
+} AtlasFormat;
+
+// Command line icons usage sources, scanned to trim iconsets
+// NOTE: Sources text is loaded once, shared (read-only) by all workers
+typedef struct IconsUsageSources {
+    char **texts;               // Source files text
+    int *sizes;                 // Source files text size
+    int count;                  // Number of source files
+} IconsUsageSources;
+
+// Command line conversion job, one per input file
+// NOTE: Output file name is resolved before processing, so jobs can be processed
+// by workers without any raylib function call (not thread-safe) or global state access
+typedef struct ConvertJob {
+    char inFileName[512];       // Input file name (.rgi)
+    char outFileName[512];      // Output file name
+    int format;                 // Output format (OutputFormat)
+    int codeFormat;             // Output code layout, only for OUTPUT_FORMAT_CODE (RGI_CODE_FORMAT_*)
+    const IconsUsageSources *usageSources;  // Icons usage sources to trim iconset, NULL if not trimmed
+    char remapFileName[512];    // Icons remap table output file (.h), only for trimmed iconsets
+    int iconCount;              // Input iconset icons count
+    int trimmedCount;           // Trimmed iconset icons count (icons used by sources)
+    int atlasFormat;            // Icons atlas output format (AtlasFormat)
+    int atlasScales[RGI_ATLAS_MAX_SCALES];  // Icons atlas scales
+    int atlasScaleCount;        // Icons atlas scales count
+    char atlasFileName[512];    // Icons atlas output file (.raw, .png)
+    char atlasCodeFileName[512];    // Icons atlas rectangles and UVs output file (.h)
+    bool success;               // Conversion succeeded
+    double encodeTime;          // Output data encoding time (in seconds)
+    int outputSize;             // Output data size (in bytes)
+    char error[128];            // Conversion error message, job is skipped if set before processing
+} ConvertJob;
+
+// Command line conversion batch, shared by all workers
+typedef struct ConvertBatch {
+    ConvertJob *jobs;           // Conversion jobs
+    int jobCount;               // Number of conversion jobs
+    int nextJob;                // Next job to be processed
+#if defined(SUPPORT_BATCH_WORKERS)
+    pthread_mutex_t mutex;      // Mutex to get next job
+#endif
+} ConvertBatch;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -499,6 +682,9 @@ static unsigned int *backupGuiIcons = guiIcons;
 static unsigned int currentIcons[RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS] = { 0 };
 static char backupGuiIconsName[RAYGUI_ICON_MAX_ICONS][32] = { 0 };
 
+// Current iconset handle, wrapping current icons data and name ids
+static rgi_iconset currentIconset = { RAYGUI_ICON_MAX_ICONS, RAYGUI_ICON_SIZE, currentIcons, (char *)guiIconsName };
+
 //----------------------------------------------------------------------------------
 // Module Functions Declaration
 //----------------------------------------------------------------------------------
@@ -506,25 +692,48 @@ static char backupGuiIconsName[RAYGUI_ICON_MAX_ICONS][32] = { 0 };
 // Command line functionality
 static void ShowCommandLineInfo(void);                      // Show command line usage info
 static void ProcessCommandLine(int argc, char *argv[]);     // Process command line input
+
+// Command line batch mode functions
+static void AddInputFiles(ConvertJob **jobs, int *jobCount, const char *input);     // Add input files as conversion jobs: file, directory or wildcards pattern
+static bool IsFileNameMatch(const char *fileName, const char *pattern);           // Check file name matches wildcards pattern (*, ?)
+static bool IsJobOutputShared(const ConvertJob *job, const ConvertJob *other);    // Check conversion jobs share any output file
+static void ProcessConvertBatch(ConvertBatch *batch, int workers);               // Process conversion jobs, using several workers if available
+static void ConvertIconsFile(ConvertJob *job);                                    // Convert one iconset file (thread-safe)
+static void AddUsageSources(IconsUsageSources *sources, const char *input);       // Add icons usage source files: file or directory (recursive)
+static void UnloadUsageSources(IconsUsageSources *sources);                       // Unload icons usage source files
+static double GetTimeCounter(void);                                               // Get wall clock time counter (in seconds, thread-safe)
 #endif
 
-// Load/Save/Export data functions
-static void LoadIconsFromImage(Image image, int iconCount, int iconSize, int iconsPerLine, int padding); // Load icons from image file
-static int SaveIcons(const char *fileName);                 // Save raygui icons file (.rgi)
-static void ExportIconsAsCode(const char *fileName);        // Export gui icons as code (.h)
+// Icons atlas functions
+static IconsAtlas LoadIconsAtlas(unsigned int *iconset, int iconCount);                // Load icons atlas texture from icons data
+static void UnloadIconsAtlas(IconsAtlas atlas);                                        // Unload icons atlas texture
+static int UpdateIconsAtlas(IconsAtlas *atlas, unsigned int *iconset);                 // Update atlas texture regions for changed icons, returns updated icons count
+static void DrawIconFromAtlas(IconsAtlas atlas, int iconId, int posX, int posY, int pixelSize, Color color); // Draw one icon from atlas, single textured quad
+
+// Icons selection panel functions
+static bool UpdateIconsPanel(IconsPanelCache *panel, Vector2 position, const char *text, int *selectedIcon, int visualStyle, bool locked); // Update icons panel (redraw if required), returns true if redrawn
+static void DrawIconsPanel(IconsPanelCache panel);                                     // Draw icons panel cached texture
+
+// Undo journal functions
+static UndoJournal LoadUndoJournal(int memoryBudget);                           // Load undo journal with a memory budget (in bytes)
+static void UnloadUndoJournal(UndoJournal *journal);                            // Unload undo journal
+static void ResetUndoJournal(UndoJournal *journal);                             // Reset undo journal, all steps removed
+static void RecordIconChange(UndoJournal *journal, int iconId);                 // Record icon state before being changed
+static bool CommitIconChanges(UndoJournal *journal);                            // Commit recorded icon changes as one undo step
+static void ApplyUndoStep(UndoStep step);                                       // Apply undo step deltas to current icons
+static bool UndoIconChanges(UndoJournal *journal);                              // Undo last step
+static bool RedoIconChanges(UndoJournal *journal);                              // Redo next step
 
 // Auxiliar functions
-static void DrawIcon(unsigned int *iconset, int iconId, int posX, int posY, int pixelSize, Color color); // Draw selected icon from iconset
-static void DrawIconData(unsigned int *data, int x, int y, int pixelSize, Color color);                 // Draw one icon, icon data provided directly
-static Image GenImageFromIconData(unsigned int *values, int iconCount, int iconsPerLine, int padding);  // Gen icons pack image from icon data array
-static Image GenImageFromBits(unsigned char *bytes, int width, int height, Color color);                // Gen image from bits data (packed in bytes)
-static unsigned char *ImageToBits(Image image);                                                         // Gen bits array (packed in bytes) from image data
-
-static unsigned int *GetIconData(unsigned int *iconset, int iconId);             // Get icon bit data
-static void SetIconData(unsigned int *iconset, int iconId, unsigned int *data);  // Set icon bit data
-static void SetIconPixel(unsigned int *iconset, int iconId, int x, int y);       // Set icon pixel value
-static void ClearIconPixel(unsigned int *iconset, int iconId, int x, int y);     // Clear icon pixel value
-static bool CheckIconPixel(unsigned int *iconset, int iconId, int x, int y);     // Check icon pixel value
+static bool LoadIconsFile(const char *fileName);                                // Load iconset file (.rgi) into current icons data and name ids
+static bool LoadIconsImageFile(const char *fileName);                           // Load iconset image file (.png) into current icons data and name ids
+static bool SaveIconsFile(const char *fileName);                                // Save current iconset file (.rgi), downloaded from memory on web
+static char *ExportIconsImageToMemory(rgi_iconset iconset, bool namesChunk, int *dataSize); // Export icons pack image as PNG to memory, name ids chunk included in one pass
+static char *LoadIconsNamesText(rgi_iconset iconset);                           // Load icons name ids joined in one text, separated by ';'
+static bool LoadIconsImageRow(const char *row, int y, void *userData);          // Load icons image row into icons data (rpng row callback)
+
+static bool IsInputEventDetected(void);                                          // Check if any input event happened (no input consumed)
+static void DrawScreenTexture(RenderTexture2D target, bool screenSizeDouble, bool waitEvents); // Draw screen render texture to screen, waiting for events after if required
 
 //------------------------------------------------------------------------------------
 // Program main entry point
@@ -534,7 +743,46 @@ int main(int argc, char *argv[])
 #if !defined(_DEBUG)
     SetTraceLogLevel(LOG_NONE);         // Disable raylib trace log messsages
 #endif
+    bool showFpsStats = false;          // Report rendered vs skipped frames and panel cache usage on exit (GUI mode)
+    int undoMemoryBudget = UNDO_MEMORY_BUDGET;  // Undo journal memory budget (GUI mode)
+
+#if defined(RPNG_THREADS)
+    rpng_set_thread_count(PNG_EXPORT_THREADS);
+#endif
+
 #if defined(PLATFORM_DESKTOP)
+    // GUI mode options, removed from arguments list once processed
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--fps-stats") == 0)
+        {
+            showFpsStats = true;
+            for (int j = i; j < (argc - 1); j++) argv[j] = argv[j + 1];
+            argc--;
+            i--;
+        }
+        else if (strcmp(argv[i], "--undo-budget") == 0)
+        {
+            // NOTE: Option is always removed, value only if provided
+            int removedCount = 1;
+
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                // NOTE: Budget limited to 2 GB, size computed in bytes as int
+                int budget = TextToInteger(argv[i + 1]);
+                if ((budget > 0) && (budget < 2*1024*1024)) undoMemoryBudget = budget*1024;
+                else printf("WARNING: Undo memory budget not valid: %s, supported range (KB): [1..%i]\n", argv[i + 1], 2*1024*1024 - 1);
+
+                removedCount = 2;
+            }
+            else printf("WARNING: No undo memory budget provided\n");
+
+            for (int j = i; j < (argc - removedCount); j++) argv[j] = argv[j + removedCount];
+            argc -= removedCount;
+            i--;
+        }
+    }
+
     // Command-line usage mode
     //--------------------------------------------------------------------------------------
     if (argc > 1)
@@ -559,7 +807,8 @@ int main(int argc, char *argv[])
     // WARNING (Windows): If program is compiled as Window application (instead of console),
     // no console is available to show output info... solution is compiling a console application
     // and closing console (FreeConsole()) when changing to GUI interface
-    FreeConsole();
+    // NOTE: Console is kept if frames stats are requested
+    if (!showFpsStats) FreeConsole();
 #endif
 
     // GUI usage mode - Initialization
@@ -630,6 +879,7 @@ int main(int argc, char *argv[])
     bool styleNameEditMode = false;         // Style name text box edit mode
 
     bool nameIdsChunkChecked = true;        // Select to embed style as a PNG chunk (rGSf)
+    int exportCompressionActive = 1;        // ComboBox PNG compression profile selection: Fast, Default, Max
     //-----------------------------------------------------------------------------------
 
     // GUI: Exit Window
@@ -647,40 +897,39 @@ int main(int argc, char *argv[])
     //bool showExportIconImageDialog = false;   // No need to export one single image
     //-----------------------------------------------------------------------------------
 
+    // Init raygui iconset for editing
+    memcpy(currentIcons, backupGuiIcons, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+    for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++) memcpy(backupGuiIconsName[i], guiIconsName[i], strlen(guiIconsName[i]));
+
     // Check if an input file has been provided on command line
     if ((inFileName[0] != '\0') && (IsFileExtension(inFileName, ".rgi")))
     {
-        char **tempIconsName = GuiLoadIcons(inFileName, true);
-        for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++) { strcpy(guiIconsName[i], tempIconsName[i]); RAYGUI_FREE(tempIconsName[i]); }
-        RAYGUI_FREE(tempIconsName);
-
-        SetWindowTitle(TextFormat("%s v%s | File: %s", toolName, toolVersion, GetFileName(inFileName)));
+        if (LoadIconsFile(inFileName)) SetWindowTitle(TextFormat("%s v%s | File: %s", toolName, toolVersion, GetFileName(inFileName)));
     }
 
-    // Init raygui iconset for editing
-    memcpy(currentIcons, backupGuiIcons, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
-    for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++) memcpy(backupGuiIconsName[i], guiIconsName[i], strlen(guiIconsName[i]));
-
     unsigned int iconData[8] = { 0 };
     char iconName[32] = { 0 };
     bool iconDataToCopy = false;
 
-    // Undo system variables
-    int currentUndoIndex = 0;
-    int firstUndoIndex = 0;
-    int lastUndoIndex = 0;
-    int undoFrameCounter = 0;
-    GuiIconSet *undoIconSet = (GuiIconSet *)calloc(MAX_UNDO_LEVELS, sizeof(GuiIconSet));
+    // Icons atlas textures used for drawing: edited iconset and copied icon
+    // NOTE: Atlas textures are updated only for the icons that changed
+    IconsAtlas iconsAtlas = LoadIconsAtlas(currentIcons, RAYGUI_ICON_MAX_ICONS);
+    IconsAtlas iconDataAtlas = LoadIconsAtlas(iconData, 1);
 
-    // Init undo system with current icons set
-    for (int i = 0; i < MAX_UNDO_LEVELS; i++)
-    {
-        undoIconSet[i].count = RAYGUI_ICON_MAX_ICONS;
-        undoIconSet[i].iconSize = RAYGUI_ICON_SIZE;
-        undoIconSet[i].values = (unsigned int *)calloc(RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS, sizeof(unsigned int));
+    // Icons selection panel cache
+    // NOTE: Panel render texture is loaded on first update, once panel size is known
+    IconsPanelCache iconsPanel = { 0 };
 
-        memcpy(undoIconSet[i].values, currentIcons, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
-    }
+    // Undo system: icon changes journal
+    UndoJournal undoJournal = LoadUndoJournal(undoMemoryBudget);
+
+    // Idle mode variables
+    // NOTE: Screen is only redrawn when some change is detected, on desktop
+    // the main loop also waits for input events when there is nothing to process
+    bool idleModeEnabled = true;
+    int redrawFramesCounter = IDLE_REDRAW_FRAMES;
+    unsigned int renderedFramesCount = 0;
+    unsigned int skippedFramesCount = 0;
 
     SetTargetFPS(60);       // Set our game to run at 60 frames-per-second
     //--------------------------------------------------------------------------------------
@@ -692,82 +941,35 @@ int main(int argc, char *argv[])
         // it contains the call to emscripten_sleep() for PLATFORM_WEB
         if (WindowShouldClose()) showExitWindow = true;
 
-        // Undo icons change logic
+        // Idle mode redraw logic
+        //----------------------------------------------------------------------------------
+        // NOTE: Text boxes in edit mode are processed every frame (keys auto-repeat)
+        if (!idleModeEnabled || showExitWindow || IsInputEventDetected() || IsWindowResized() || IsFileDropped() ||
+            iconNameIdEditMode || styleNameEditMode) redrawFramesCounter = IDLE_REDRAW_FRAMES;
         //----------------------------------------------------------------------------------
-        // Make sure no windows are open to store changes
-        if (!windowHelpState.windowActive &&
-            !windowAboutState.windowActive &&
-            !showIssueReportWindow &&
-            !showExitWindow &&
-            !showLoadFileDialog &&
-            !showSaveFileDialog &&
-            !showExportFileDialog)
-        {
-            undoFrameCounter++;
-
-            // Every 120 frames checking if current state has changed and record a new undo state
-            if (undoFrameCounter >= 120)
-            {
-                if (memcmp(undoIconSet[currentUndoIndex].values, currentIcons, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int)) != 0)
-                {
-                    // Move cursor to next available position to record undo
-                    currentUndoIndex++;
-                    if (currentUndoIndex >= MAX_UNDO_LEVELS) currentUndoIndex = 0;
-                    if (currentUndoIndex == firstUndoIndex) firstUndoIndex++;
-                    if (firstUndoIndex >= MAX_UNDO_LEVELS) firstUndoIndex = 0;
-
-                    memcpy(undoIconSet[currentUndoIndex].values, currentIcons, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
-
-                    lastUndoIndex = currentUndoIndex;
-
-                    // Set a '*' mark on loaded file name to notice save requirement
-                    if ((inFileName[0] != '\0') && !saveChangesRequired)
-                    {
-                        SetWindowTitle(TextFormat("%s v%s | File: %s*", toolName, toolVersion, GetFileName(inFileName)));
-                        saveChangesRequired = true;
-                    }
-                }
-
-                undoFrameCounter = 0;
-            }
-        }
-        else undoFrameCounter = 120;
 
-        // Recover previous layout state from buffer
-        if ((IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_Z)) || mainToolbarState.btnUndoPressed)
+        // Undo icons change logic
+        //----------------------------------------------------------------------------------
+        // Commit recorded icon changes once edit is finished (no painting or name editing)
+        // NOTE: Every edit operation is recorded when it happens, a full paint stroke is one undo step
+        if (!IsMouseButtonDown(MOUSE_LEFT_BUTTON) && !IsMouseButtonDown(MOUSE_RIGHT_BUTTON) && !iconNameIdEditMode)
         {
-            if (currentUndoIndex != firstUndoIndex)
+            if (CommitIconChanges(&undoJournal))
             {
-                currentUndoIndex--;
-                if (currentUndoIndex < 0) currentUndoIndex = MAX_UNDO_LEVELS - 1;
-
-                if (memcmp(undoIconSet[currentUndoIndex].values, currentIcons, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int)) != 0)
+                // Set a '*' mark on loaded file name to notice save requirement
+                if ((inFileName[0] != '\0') && !saveChangesRequired)
                 {
-                    // Restore previous icons state
-                    memcpy(currentIcons, undoIconSet[currentUndoIndex].values,  RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+                    SetWindowTitle(TextFormat("%s v%s | File: %s*", toolName, toolVersion, GetFileName(inFileName)));
+                    saveChangesRequired = true;
                 }
             }
         }
 
-        // Recover next layout state from buffer
-        if ((IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_Y)) || mainToolbarState.btnRedoPressed)
-        {
-            if (currentUndoIndex != lastUndoIndex)
-            {
-                int nextUndoIndex = currentUndoIndex + 1;
-                if (nextUndoIndex >= MAX_UNDO_LEVELS) nextUndoIndex = 0;
-
-                if (nextUndoIndex != firstUndoIndex)
-                {
-                    currentUndoIndex = nextUndoIndex;
+        // Recover previous icons state from journal
+        if ((IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_Z)) || mainToolbarState.btnUndoPressed) UndoIconChanges(&undoJournal);
 
-                    if (memcmp(undoIconSet[currentUndoIndex].values, currentIcons, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int)) != 0)
-                    {
-                        memcpy(currentIcons, undoIconSet[currentUndoIndex].values,  RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
-                    }
-                }
-            }
-        }
+        // Recover next icons state from journal
+        if ((IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_Y)) || mainToolbarState.btnRedoPressed) RedoIconChanges(&undoJournal);
         //----------------------------------------------------------------------------------
 
         // Dropped files logic
@@ -778,23 +980,26 @@ int main(int argc, char *argv[])
 
             if (IsFileExtension(droppedFiles.paths[0], ".rgi"))
             {
-                // Load .rgi data into raygui icons set (and gui icon names for the tool)
-                char **tempIconsName = GuiLoadIcons(droppedFiles.paths[0], true);
-                memcpy(currentIcons, guiIcons, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
-                for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++) { strcpy(guiIconsName[i], tempIconsName[i]); RAYGUI_FREE(tempIconsName[i]); }
-                RAYGUI_FREE(tempIconsName);
+                // Load .rgi data into current icons set (and gui icon names for the tool)
+                if (LoadIconsFile(droppedFiles.paths[0]))
+                {
+                    ResetUndoJournal(&undoJournal);
 
-                strcpy(inFileName, droppedFiles.paths[0]);
-                SetWindowTitle(TextFormat("%s v%s | File: %s", toolName, toolVersion, GetFileName(inFileName)));
+                    strcpy(inFileName, droppedFiles.paths[0]);
+                    SetWindowTitle(TextFormat("%s v%s | File: %s", toolName, toolVersion, GetFileName(inFileName)));
+                }
             }
             else if (IsFileExtension(droppedFiles.paths[0], ".png"))
             {
-                // TODO: Support icons loading from image
-                //Image image = LoadImage(droppedFiles[0]);
-                //LoadIconsFromImage(image, RAYGUI_ICON_MAX_ICONS, 16, 16, 1);    // Loading window required to config parameters (similar to raw)
-                //UnloadImage(image);
+                // Load icons image into current icons set, as exported by the tool (16 icons per line, 1 pixel padding)
+                // NOTE: Image import is an icons edit (undoable), the iconset requires to be saved as a new .rgi file
+                for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++) RecordIconChange(&undoJournal, i);
 
-                // TODO: Load icons name id from PNG zTXt chunk if available
+                if (LoadIconsImageFile(droppedFiles.paths[0]))
+                {
+                    inFileName[0] = '\0';
+                    SetWindowTitle(TextFormat("%s v%s | File: %s (imported)", toolName, toolVersion, GetFileName(droppedFiles.paths[0])));
+                }
             }
             else if (IsFileExtension(droppedFiles.paths[0], ".rgs")) GuiLoadStyle(droppedFiles.paths[0]);
 
@@ -807,6 +1012,7 @@ int main(int argc, char *argv[])
         if ((IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_N)) || mainToolbarState.btnNewFilePressed)
         {
             // Create new empty icon pack
+            for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++) RecordIconChange(&undoJournal, i);
             memset(currentIcons, 0, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(int));
             for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++) memset(guiIconsName[i], 0, RAYGUI_ICON_MAX_NAME_LENGTH);
         }
@@ -814,6 +1020,7 @@ int main(int argc, char *argv[])
         if (mainToolbarState.btnReloadSetPressed)
         {
             // Reload original raygui icon set
+            for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++) RecordIconChange(&undoJournal, i);
             memcpy(currentIcons, backupGuiIcons, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(int));
             for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++) memcpy(guiIconsName[i], backupGuiIconsName[i], strlen(backupGuiIconsName[i]));
         }
@@ -832,7 +1039,7 @@ int main(int argc, char *argv[])
             }
             else if (saveChangesRequired)
             {
-                SaveIcons(inFileName);
+                rgi_save_iconset(currentIconset, inFileName);
                 SetWindowTitle(TextFormat("%s v%s | File: %s", toolName, toolVersion, GetFileName(inFileName)));
                 saveChangesRequired = false;
             }
@@ -848,8 +1055,9 @@ int main(int argc, char *argv[])
         // Cut button/shortcut logic
         if ((IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_X)) || mainToolbarState.btnCutPressed)
         {
-            memcpy(iconData, GetIconData(currentIcons, selectedIcon), RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
-            for (int i = 0; i < RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE; i++) ClearIconPixel(currentIcons, selectedIcon, i/RAYGUI_ICON_SIZE, i%RAYGUI_ICON_SIZE);
+            RecordIconChange(&undoJournal, selectedIcon);
+            memcpy(iconData, rgi_get_icon_view(currentIconset, selectedIcon), RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+            for (int i = 0; i < RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE; i++) rgi_clear_icon_pixel(currentIconset, selectedIcon, i/RAYGUI_ICON_SIZE, i%RAYGUI_ICON_SIZE);
 
             strcpy(iconName, guiIconsName[selectedIcon]);
             memset(guiIconsName[selectedIcon], 0, RAYGUI_ICON_MAX_NAME_LENGTH);
@@ -860,7 +1068,7 @@ int main(int argc, char *argv[])
         // Copy button/shortcut logic
         if ((IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_C)) || mainToolbarState.btnCopyPressed)
         {
-            memcpy(iconData, GetIconData(currentIcons, selectedIcon), RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+            memcpy(iconData, rgi_get_icon_view(currentIconset, selectedIcon), RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
             strcpy(iconName, guiIconsName[selectedIcon]);
             iconDataToCopy = true;
         }
@@ -870,7 +1078,8 @@ int main(int argc, char *argv[])
         {
             if (iconDataToCopy)
             {
-                SetIconData(currentIcons, selectedIcon, iconData);
+                RecordIconChange(&undoJournal, selectedIcon);
+                rgi_set_icon_data(currentIconset, selectedIcon, iconData);
                 strcpy(guiIconsName[selectedIcon], iconName);
             }
         }
@@ -883,11 +1092,13 @@ int main(int argc, char *argv[])
                 int movePosition = selectedIcon - 32;
                 unsigned int tmpIconData[8] = { 0 };
                 char tmpIconName[32] = { 0 };
-                memcpy(tmpIconData, GetIconData(currentIcons, movePosition), RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+                RecordIconChange(&undoJournal, selectedIcon);
+                RecordIconChange(&undoJournal, movePosition);
+                memcpy(tmpIconData, rgi_get_icon_view(currentIconset, movePosition), RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
                 strcpy(tmpIconName, guiIconsName[movePosition]);
 
-                SetIconData(currentIcons, movePosition, GetIconData(currentIcons, selectedIcon));
-                SetIconData(currentIcons, selectedIcon, tmpIconData);
+                rgi_set_icon_data(currentIconset, movePosition, rgi_get_icon_view(currentIconset, selectedIcon));
+                rgi_set_icon_data(currentIconset, selectedIcon, tmpIconData);
                 strcpy(guiIconsName[movePosition], guiIconsName[selectedIcon]);
                 strcpy(guiIconsName[selectedIcon], tmpIconName);
 
@@ -903,11 +1114,13 @@ int main(int argc, char *argv[])
                 int movePosition = selectedIcon + 32;
                 unsigned int tmpIconData[8] = { 0 };
                 char tmpIconName[32] = { 0 };
-                memcpy(tmpIconData, GetIconData(currentIcons, movePosition), RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+                RecordIconChange(&undoJournal, selectedIcon);
+                RecordIconChange(&undoJournal, movePosition);
+                memcpy(tmpIconData, rgi_get_icon_view(currentIconset, movePosition), RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
                 strcpy(tmpIconName, guiIconsName[movePosition]);
 
-                SetIconData(currentIcons, movePosition, GetIconData(currentIcons, selectedIcon));
-                SetIconData(currentIcons, selectedIcon, tmpIconData);
+                rgi_set_icon_data(currentIconset, movePosition, rgi_get_icon_view(currentIconset, selectedIcon));
+                rgi_set_icon_data(currentIconset, selectedIcon, tmpIconData);
                 strcpy(guiIconsName[movePosition], guiIconsName[selectedIcon]);
                 strcpy(guiIconsName[selectedIcon], tmpIconName);
 
@@ -923,11 +1136,13 @@ int main(int argc, char *argv[])
                 int movePosition = selectedIcon - 1;
                 unsigned int tmpIconData[8] = { 0 };
                 char tmpIconName[32] = { 0 };
-                memcpy(tmpIconData, GetIconData(currentIcons, movePosition), RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+                RecordIconChange(&undoJournal, selectedIcon);
+                RecordIconChange(&undoJournal, movePosition);
+                memcpy(tmpIconData, rgi_get_icon_view(currentIconset, movePosition), RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
                 strcpy(tmpIconName, guiIconsName[movePosition]);
 
-                SetIconData(currentIcons, movePosition, GetIconData(currentIcons, selectedIcon));
-                SetIconData(currentIcons, selectedIcon, tmpIconData);
+                rgi_set_icon_data(currentIconset, movePosition, rgi_get_icon_view(currentIconset, selectedIcon));
+                rgi_set_icon_data(currentIconset, selectedIcon, tmpIconData);
                 strcpy(guiIconsName[movePosition], guiIconsName[selectedIcon]);
                 strcpy(guiIconsName[selectedIcon], tmpIconName);
 
@@ -938,16 +1153,18 @@ int main(int argc, char *argv[])
         // Move selected icon right on the list
         if ((IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_RIGHT)) || mainToolbarState.btnMoveRightPressed)
         {
-            if (selectedIcon < RAYGUI_ICON_MAX_ICONS)
+            if (selectedIcon < (RAYGUI_ICON_MAX_ICONS - 1))
             {
                 int movePosition = selectedIcon + 1;
                 unsigned int tmpIconData[8] = { 0 };
                 char tmpIconName[32] = { 0 };
-                memcpy(tmpIconData, GetIconData(currentIcons, movePosition), RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+                RecordIconChange(&undoJournal, selectedIcon);
+                RecordIconChange(&undoJournal, movePosition);
+                memcpy(tmpIconData, rgi_get_icon_view(currentIconset, movePosition), RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
                 strcpy(tmpIconName, guiIconsName[movePosition]);
 
-                SetIconData(currentIcons, movePosition, GetIconData(currentIcons, selectedIcon));
-                SetIconData(currentIcons, selectedIcon, tmpIconData);
+                rgi_set_icon_data(currentIconset, movePosition, rgi_get_icon_view(currentIconset, selectedIcon));
+                rgi_set_icon_data(currentIconset, selectedIcon, tmpIconData);
                 strcpy(guiIconsName[movePosition], guiIconsName[selectedIcon]);
                 strcpy(guiIconsName[selectedIcon], tmpIconName);
 
@@ -958,68 +1175,53 @@ int main(int argc, char *argv[])
         // Flip icon horizontally
         if (mainToolbarState.btnFlipHPressed)
         {
-            for (int i = 0; i < RAYGUI_ICON_SIZE/2; i++)
-            {
-                unsigned int x = currentIcons[selectedIcon*RAYGUI_ICON_DATA_ELEMENTS + i];
-
-                unsigned short r0 = x & 0xFFFF;
-                r0 = ((r0 & 0x5555) << 1) | ((r0 >> 1) & 0x5555);
-                r0 = ((r0 & 0x3333) << 2) | ((r0 >> 2) & 0x3333);
-                r0 = ((r0 & 0x0F0F) << 4) | ((r0 >> 4) & 0x0F0F);
-                r0 = (r0 << 8) | (r0 >> 8);
-
-                unsigned short r1 = x >> 16;
-                r1 = ((r1 & 0x5555) << 1) | ((r1 >> 1) & 0x5555);
-                r1 = ((r1 & 0x3333) << 2) | ((r1 >> 2) & 0x3333);
-                r1 = ((r1 & 0x0F0F) << 4) | ((r1 >> 4) & 0x0F0F);
-                r1 = (r1 << 8) | (r1 >> 8);
-
-                currentIcons[selectedIcon*RAYGUI_ICON_DATA_ELEMENTS + i] = (r1 << 16) | r0;
-            }
+            RecordIconChange(&undoJournal, selectedIcon);
+            rgi_flip_icons_h(currentIconset, selectedIcon, 1);
         }
 
         // Flip icon vertically
         if (mainToolbarState.btnFlipVPressed)
         {
-            for (int i = 0; i < 4; i++)
-            {
-                unsigned int temp = currentIcons[selectedIcon*RAYGUI_ICON_DATA_ELEMENTS + i];
-                currentIcons[selectedIcon*RAYGUI_ICON_DATA_ELEMENTS + i] = (currentIcons[selectedIcon*RAYGUI_ICON_DATA_ELEMENTS + 7 - i] << 16) | (currentIcons[selectedIcon*RAYGUI_ICON_DATA_ELEMENTS + 7 - i] >> 16);
-                currentIcons[selectedIcon*RAYGUI_ICON_DATA_ELEMENTS + 7 - i] = (temp << 16) | (temp >> 16);
-            }
+            RecordIconChange(&undoJournal, selectedIcon);
+            rgi_flip_icons_v(currentIconset, selectedIcon, 1);
         }
 
-        // Rotate icon 90 degrees clockwise
-        if (mainToolbarState.btnRotatePressed)
+        // Rotate icon 90 degrees clockwise (LSHIFT: counterclockwise, LALT: 180 degrees)
+        if (mainToolbarState.btnRotatePressed || (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_R)))
         {
-            unsigned int rotatedIcon[8] = { 0 };
+            RecordIconChange(&undoJournal, selectedIcon);
 
-            for (int y = 0; y < 16; y++)
-            {
-                unsigned int src = currentIcons[selectedIcon*RAYGUI_ICON_DATA_ELEMENTS + (y >> 1)];
-                unsigned short row = (y & 1)? (src >> 16) : (src & 0xFFFF);
+            if (IsKeyDown(KEY_LEFT_SHIFT)) rgi_rotate_icons(currentIconset, selectedIcon, 1, 270);
+            else if (IsKeyDown(KEY_LEFT_ALT)) rgi_rotate_icons(currentIconset, selectedIcon, 1, 180);
+            else rgi_rotate_icons(currentIconset, selectedIcon, 1, 90);
+        }
 
-                for (int x = 0; x < 16; x++)
-                {
-                    if (row & (1u << (15 - x)))
-                    {
-                        int nx = y;
-                        int ny = 15 - x;
+        // Invert icon pixels
+        if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_I))
+        {
+            RecordIconChange(&undoJournal, selectedIcon);
+            rgi_invert_icons(currentIconset, selectedIcon, 1);
+        }
 
-                        if (ny & 1) rotatedIcon[ny >> 1] |= (1u << (15 - nx)) << 16;
-                        else rotatedIcon[ny >> 1] |= (1u << (15 - nx));
-                    }
-                }
-            }
+        // Shift icon pixels (nudge) one pixel
+        if (IsKeyDown(KEY_LEFT_SHIFT) && !IsKeyDown(KEY_LEFT_CONTROL) && !iconNameIdEditMode)
+        {
+            int offsetX = (int)IsKeyPressed(KEY_RIGHT) - (int)IsKeyPressed(KEY_LEFT);
+            int offsetY = (int)IsKeyPressed(KEY_DOWN) - (int)IsKeyPressed(KEY_UP);
 
-            for (int i = 0; i < 8; i++)
-                currentIcons[selectedIcon*RAYGUI_ICON_DATA_ELEMENTS + i] = rotatedIcon[i];
+            if ((offsetX != 0) || (offsetY != 0))
+            {
+                RecordIconChange(&undoJournal, selectedIcon);
+                rgi_shift_icons(currentIconset, selectedIcon, 1, offsetX, offsetY);
+            }
         }
 
         // Clean selected icon
         if (IsKeyPressed(KEY_DELETE) || mainToolbarState.btnCleanPressed)
         {
-            for (int i = 0; i < RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE; i++) ClearIconPixel(currentIcons, selectedIcon, i/RAYGUI_ICON_SIZE, i%RAYGUI_ICON_SIZE);
+            RecordIconChange(&undoJournal, selectedIcon);
+
+            for (int i = 0; i < RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE; i++) rgi_clear_icon_pixel(currentIconset, selectedIcon, i/RAYGUI_ICON_SIZE, i%RAYGUI_ICON_SIZE);
 
             memset(guiIconsName[selectedIcon], 0, RAYGUI_ICON_MAX_NAME_LENGTH);
         }
@@ -1089,6 +1291,7 @@ int main(int argc, char *argv[])
             }
 
             saveChangesRequired = false;
+            redrawFramesCounter = IDLE_REDRAW_FRAMES;
 
             mainToolbarState.prevVisualStyleActive = mainToolbarState.visualStyleActive;
         }
@@ -1130,8 +1333,10 @@ int main(int argc, char *argv[])
                 // Icon painting mouse logic
                 if ((cell.x >= 0) && (cell.y >= 0) && (cell.x < RAYGUI_ICON_SIZE) && (cell.y < RAYGUI_ICON_SIZE))
                 {
-                    if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) SetIconPixel(currentIcons, selectedIcon, (int)cell.x, (int)cell.y);
-                    else if (IsMouseButtonDown(MOUSE_RIGHT_BUTTON)) ClearIconPixel(currentIcons, selectedIcon, (int)cell.x, (int)cell.y);
+                    if (IsMouseButtonDown(MOUSE_LEFT_BUTTON) || IsMouseButtonDown(MOUSE_RIGHT_BUTTON)) RecordIconChange(&undoJournal, selectedIcon);
+
+                    if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) rgi_set_icon_pixel(currentIconset, selectedIcon, (int)cell.x, (int)cell.y);
+                    else if (IsMouseButtonDown(MOUSE_RIGHT_BUTTON)) rgi_clear_icon_pixel(currentIconset, selectedIcon, (int)cell.x, (int)cell.y);
                 }
             }
         }
@@ -1174,6 +1379,38 @@ int main(int argc, char *argv[])
         }
         //----------------------------------------------------------------------------------
 
+        // Icons atlas update logic
+        //----------------------------------------------------------------------------------
+        // NOTE: Only the texture regions of the changed icons are uploaded again
+        if (UpdateIconsAtlas(&iconsAtlas, currentIcons) > 0)
+        {
+            iconsPanel.valid = false;
+            redrawFramesCounter = IDLE_REDRAW_FRAMES;
+        }
+        if (iconDataToCopy) UpdateIconsAtlas(&iconDataAtlas, iconData);
+        //----------------------------------------------------------------------------------
+
+        // Idle frame: nothing changed, gui drawing skipped and previous screen render texture drawn again
+        if (redrawFramesCounter == 0)
+        {
+            GuiUnlock();    // Unlock main screen controls, as done after drawing them
+            skippedFramesCount++;
+
+            DrawScreenTexture(target, screenSizeDouble, idleModeEnabled && (undoJournal.pendingCount == 0));
+            continue;
+        }
+
+        // Icons selection panel update logic
+        //----------------------------------------------------------------------------------
+        // NOTE: Panel is redrawn (and selection input processed) only if required,
+        // it must be done before BeginTextureMode(target) because texture modes can not be nested
+        // NOTE: raygui icons pointer points to current iconset to be used on drawing (instead of the internal one)
+        guiIconsPtr = currentIcons;
+        UpdateIconsPanel(&iconsPanel, (Vector2){ anchor01.x + 15, anchor01.y + 70 }, toggleIconsText, &selectedIcon,
+            mainToolbarState.visualStyleActive, GuiIsLocked() || iconNameIdEditMode);
+        guiIconsPtr = backupGuiIcons;
+        //----------------------------------------------------------------------------------
+
         // Draw
         //----------------------------------------------------------------------------------
         // Render all screen to texture (for scaling)
@@ -1184,21 +1421,19 @@ int main(int argc, char *argv[])
             //---------------------------------------------------------------------------------------------------------
             GuiLabel((Rectangle){ anchor01.x + 15, anchor01.y + 45, 140, 25 }, "Choose icon for edit:");
 
-            // Draw icons selection panel
-            // NOTE: raygui icons pointer points to current iconset to be used on drawing (instead of the internal one)
-            //GuiSetStyle(TOGGLE, GROUP_PADDING, -1);
-            guiIconsPtr = currentIcons;
-            GuiToggleGroup((Rectangle){ anchor01.x + 15, anchor01.y + 70, 18, 18 }, toggleIconsText, &selectedIcon);
-            guiIconsPtr = backupGuiIcons;
+            // Draw icons selection panel (cached texture)
+            DrawIconsPanel(iconsPanel);
 
             // Draw icon name ID text box
+            // NOTE: Icon is recorded for undo while name is edited, committed when editing finishes
+            if (iconNameIdEditMode) RecordIconChange(&undoJournal, selectedIcon);
             GuiLabel((Rectangle){ anchor01.x + 672, anchor01.y + 45, 126, 25 }, "Icon name ID:");
             if (GuiTextBox((Rectangle){ anchor01.x + 672, anchor01.y + 70, 258, 25 }, guiIconsName[selectedIcon],
                 RAYGUI_ICON_MAX_NAME_LENGTH, iconNameIdEditMode)) iconNameIdEditMode = !iconNameIdEditMode;
 
             // Draw selected icon at selected scale
             DrawRectangle(anchor01.x + 672, anchor01.y + 108, 256, 256, Fade(GetColor(GuiGetStyle(DEFAULT, BASE_COLOR_NORMAL)), 0.3f));
-            DrawIcon(currentIcons, selectedIcon, (int)anchor01.x + 672 + 128 - RAYGUI_ICON_SIZE*iconEditScale/2, (int)anchor01.y + 108 + 128 - RAYGUI_ICON_SIZE*iconEditScale/2, iconEditScale, GetColor(GuiGetStyle(LABEL, TEXT_COLOR_NORMAL)));
+            DrawIconFromAtlas(iconsAtlas, selectedIcon, (int)anchor01.x + 672 + 128 - RAYGUI_ICON_SIZE*iconEditScale/2, (int)anchor01.y + 108 + 128 - RAYGUI_ICON_SIZE*iconEditScale/2, iconEditScale, GetColor(GuiGetStyle(LABEL, TEXT_COLOR_NORMAL)));
 
             // Draw grid
             GuiGrid((Rectangle){ anchor01.x + 672 + 128 - RAYGUI_ICON_SIZE*iconEditScale/2, anchor01.y + 108 + 128 - RAYGUI_ICON_SIZE*iconEditScale/2,
@@ -1257,7 +1492,7 @@ int main(int argc, char *argv[])
             // GUI: Main toolbar panel
             //----------------------------------------------------------------------------------
             GuiMainToolbar(&mainToolbarState);
-            if (iconDataToCopy) DrawIconData(iconData, mainToolbarState.anchorEdit.x + 12 + 72 + 16 + 4, mainToolbarState.anchorEdit.y + 8 + 4, 1, GetColor(GuiGetStyle(DEFAULT, TEXT_COLOR_NORMAL)));
+            if (iconDataToCopy) DrawIconFromAtlas(iconDataAtlas, 0, mainToolbarState.anchorEdit.x + 12 + 72 + 16 + 4, mainToolbarState.anchorEdit.y + 8 + 4, 1, GetColor(GuiGetStyle(DEFAULT, TEXT_COLOR_NORMAL)));
             //----------------------------------------------------------------------------------
 
             // GUI: Status bar
@@ -1312,7 +1547,7 @@ int main(int argc, char *argv[])
             //----------------------------------------------------------------------------------------
             if (showExportWindow)
             {
-                Rectangle messageBox = { (float)screenWidth/2 - 280/2, (float)screenHeight/2 - 176/2 - 30, 280, 176 };
+                Rectangle messageBox = { (float)screenWidth/2 - 280/2, (float)screenHeight/2 - 208/2 - 30, 280, 208 };
                 int result = GuiMessageBox(messageBox, "#7#Export Iconset File", " ", "#7#Export Iconset");
 
                 GuiLabel((Rectangle){ messageBox.x + 12, messageBox.y + 24 + 12, 106, 24 }, "Iconset Name:");
@@ -1322,7 +1557,9 @@ int main(int argc, char *argv[])
                 GuiComboBox((Rectangle){ messageBox.x + 12 + 92, messageBox.y + 12 + 48 + 8, 164, 24 }, "raygui (.rgi);Image (.png);Code (.h)", &exportFormatActive);
 
                 if (exportFormatActive != 1) GuiDisable();
-                GuiCheckBox((Rectangle){ messageBox.x + 20, messageBox.y + 52 + 32 + 24, 16, 16 }, "Embed name IDs as zTXt chunk", &nameIdsChunkChecked);
+                GuiLabel((Rectangle){ messageBox.x + 12, messageBox.y + 12 + 48 + 8 + 32, 106, 24 }, "Compression:");
+                GuiComboBox((Rectangle){ messageBox.x + 12 + 92, messageBox.y + 12 + 48 + 8 + 32, 164, 24 }, "Fast;Default;Max", &exportCompressionActive);
+                GuiCheckBox((Rectangle){ messageBox.x + 20, messageBox.y + 52 + 32 + 24 + 32, 16, 16 }, "Embed name IDs as zTXt chunk", &nameIdsChunkChecked);
                 GuiEnable();
 
                 if (result == 1)    // Export button pressed
@@ -1359,13 +1596,13 @@ int main(int argc, char *argv[])
                 if (result == 1)
                 {
                     // Load gui icons data (and gui icon names for the tool)
-                    char **tempIconsName = GuiLoadIcons(inFileName, true);
-                    memcpy(currentIcons, guiIcons, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
-                    for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++) { strcpy(guiIconsName[i], tempIconsName[i]); RAYGUI_FREE(tempIconsName[i]); }
-                    RAYGUI_FREE(tempIconsName);
+                    if (LoadIconsFile(inFileName))
+                    {
+                        ResetUndoJournal(&undoJournal);
 
-                    SetWindowTitle(TextFormat("%s v%s | File: %s", toolName, toolVersion, GetFileName(inFileName)));
-                    saveChangesRequired = false;
+                        SetWindowTitle(TextFormat("%s v%s | File: %s", toolName, toolVersion, GetFileName(inFileName)));
+                        saveChangesRequired = false;
+                    }
                 }
 
                 if (result >= 0) showLoadFileDialog = false;
@@ -1389,14 +1626,7 @@ int main(int argc, char *argv[])
                     if ((GetFileExtension(outFileName) == NULL) || !IsFileExtension(outFileName, ".rgi")) strcat(outFileName, ".rgi\0");
 
                     // Save icons file
-                    SaveIcons(outFileName);
-
-                #if defined(PLATFORM_WEB)
-                    // Download file from MEMFS (emscripten memory filesystem)
-                    // NOTE: Second argument must be a simple filename (can't use directories)
-                    // NOTE: Included security check to (partially) avoid malicious code on PLATFORM_WEB
-                    if (strchr(outFileName, '\'') == NULL) emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", outFileName, GetFileName(outFileName)));
-                #endif
+                    SaveIconsFile(outFileName);
                 }
 
                 if (result >= 0) showSaveFileDialog = false;
@@ -1432,39 +1662,32 @@ int main(int argc, char *argv[])
                         {
                             // Check for valid extension and make sure it is
                             if ((GetFileExtension(outFileName) == NULL) || !IsFileExtension(outFileName, ".rgi")) strcat(outFileName, ".rgi\0");
-                            SaveIcons(outFileName);
+                            SaveIconsFile(outFileName);
                         } break;
                         case 1:
                         {
                             // Check for valid extension and make sure it is
                             if ((GetFileExtension(outFileName) == NULL) || !IsFileExtension(outFileName, ".png")) strcat(outFileName, ".png\0");
-                            Image image = GenImageFromIconData(currentIcons, RAYGUI_ICON_MAX_ICONS, 16, 1);
-                            ExportImage(image, outFileName);
-                            UnloadImage(image);
 
-                            if (nameIdsChunkChecked)
+                            // NOTE: PNG image and icons name ids zTXt chunk are generated in memory, file written once
+                            const int compressionLevels[3] = { COMPRESSION_LEVEL_FAST, COMPRESSION_LEVEL_DEFAULT, COMPRESSION_LEVEL_MAX };
+                            rpng_set_compression_level(compressionLevels[exportCompressionActive]);
+
+                            int pngDataSize = 0;
+                            char *pngData = ExportIconsImageToMemory(currentIconset, nameIdsChunkChecked, &pngDataSize);
+
+                            if ((pngData == NULL) || (rgi_save_file_data(outFileName, (const unsigned char *)pngData, pngDataSize) != RGI_SUCCESS))
                             {
-                                // Concatenate all icons names into one string
-                                char *iconsNames = (char *)RL_CALLOC(RAYGUI_ICON_MAX_ICONS*(RAYGUI_ICON_MAX_NAME_LENGTH + 1), 1);
-                                char *iconsNamesPtr = iconsNames;
-                                for (int i = 0, size = 0; i < RAYGUI_ICON_MAX_ICONS; i++)
-                                {
-                                    size = strlen(guiIconsName[i]);
-                                    memcpy(iconsNamesPtr, guiIconsName[i], size);
-                                    iconsNamesPtr[size] = ';';
-                                    iconsNamesPtr += (size + 1);
-                                }
-
-                                // Save icons name id into PNG zTXt chunk
-                                rpng_chunk_write_comp_text(outFileName, "Description", iconsNames);
-                                RL_FREE(iconsNames);
+                                LOG("WARNING: [%s] Icons image file could not be saved\n", outFileName);
                             }
+
+                            RPNG_FREE(pngData);
                         } break;
                         case 2:
                         {
                             // Check for valid extension and make sure it is
                             if ((GetFileExtension(outFileName) == NULL) || !IsFileExtension(outFileName, ".h")) strcat(outFileName, ".h\0");
-                            ExportIconsAsCode(outFileName);
+                            rgi_export_iconset_as_code(currentIconset, outFileName);
                         } break;
                         default: break;
                     }
@@ -1472,7 +1695,8 @@ int main(int argc, char *argv[])
                 #if defined(PLATFORM_WEB)
                     // Download file from MEMFS (emscripten memory filesystem)
                     // NOTE: Second argument must be a simple filename (can't use directories)
-                    emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", outFileName, GetFileName(outFileName)));
+                    // NOTE: Icons file (.rgi) is downloaded directly from memory on saving
+                    if (exportFormatActive != 0) emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", outFileName, GetFileName(outFileName)));
                 #endif
                 }
 
@@ -1497,7 +1721,7 @@ int main(int argc, char *argv[])
                     // Export file: outFileName
                     // Check for valid extension and make sure it is
                     if ((GetFileExtension(outFileName) == NULL) || !IsFileExtension(outFileName, ".png")) strcat(outFileName, ".png\0");
-                    Image icon = GenImageFromIconData(GuiGetIconData(selectedIcon), 1, 1, 0);
+                    Image icon = GenImageFromIconData((rgi_iconset){ 1, RAYGUI_ICON_SIZE, &currentIcons[selectedIcon*RAYGUI_ICON_DATA_ELEMENTS], guiIconsName[selectedIcon] }, 1, 0);
                     ExportImage(icon, outFileName);
                     UnloadImage(icon);
 
@@ -1518,19 +1742,27 @@ int main(int argc, char *argv[])
 
         EndTextureMode();
 
-        BeginDrawing();
-            ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
-
-            // Draw render texture to screen
-            if (screenSizeDouble) DrawTexturePro(target.texture, (Rectangle){ 0, 0, (float)target.texture.width, -(float)target.texture.height }, (Rectangle){ 0, 0, (float)target.texture.width*2, (float)target.texture.height*2 }, (Vector2){ 0, 0 }, 0.0f, WHITE);
-            else DrawTextureRec(target.texture, (Rectangle){ 0, 0, (float)target.texture.width, -(float)target.texture.height }, (Vector2){ 0, 0 }, WHITE);
+        redrawFramesCounter--;
+        renderedFramesCount++;
 
-        EndDrawing();
+        // Idle mode: wait for input events when there is nothing pending to redraw or commit
+        DrawScreenTexture(target, screenSizeDouble, idleModeEnabled && (redrawFramesCounter == 0) && (undoJournal.pendingCount == 0));
         //----------------------------------------------------------------------------------
     }
 
     // De-Initialization
     //--------------------------------------------------------------------------------------
+    UnloadIconsAtlas(iconsAtlas);       // Unload icons atlas texture
+    UnloadIconsAtlas(iconDataAtlas);    // Unload copied icon atlas texture
+    UnloadRenderTexture(iconsPanel.target); // Unload icons panel render texture
+    UnloadUndoJournal(&undoJournal);    // Unload undo journal steps
+
+    if (showFpsStats)
+    {
+        printf("INFO: Frames rendered: %u, frames skipped (idle): %u\n", renderedFramesCount, skippedFramesCount);
+        printf("INFO: Icons panel cache: %u redraws, %u reuses\n", iconsPanel.rebuildCount, iconsPanel.reuseCount);
+    }
+
     CloseWindow();              // Close window and OpenGL context
     //--------------------------------------------------------------------------------------
 
@@ -1557,20 +1789,65 @@ static void ShowCommandLineInfo(void)
 
     printf("USAGE:\n\n");
     printf("    > rguiicons [--help] --input <filename.ext> [--output <filename.ext>]\n");
+    printf("    > rguiicons --input <file/dir/pattern> ... [--output-dir <path>] [--format <ext>] [--jobs <n>]\n");
 
     printf("\nOPTIONS:\n\n");
     printf("    -h, --help                      : Show tool version and command line usage help\n");
-    printf("    -i, --input <filename.ext>      : Define input file.\n");
+    printf("    -i, --input <filename.ext> ...  : Define input files, directories or wildcards patterns (*, ?).\n");
     printf("                                      Supported extensions: .rgi\n");
-    printf("    -o, --output <filename.ext>     : Define output file.\n");
+    printf("    -o, --output <filename.ext>     : Define output file (single input file).\n");
     printf("                                      Supported extensions: .rgi, .png, .h\n");
-    printf("                                      NOTE: If not specified, defaults to: output.rgi\n\n");
+    printf("                                      NOTE: If not specified, defaults to: output.rgi\n");
+    printf("                                      NOTE: Use '-' to write to stdout, format defined by --format\n");
+    printf("    -d, --output-dir <path>         : Define output directory (batch mode).\n");
+    printf("                                      NOTE: If not specified, defaults to input file directory\n");
+    printf("    -f, --format <ext>              : Define output format (batch mode).\n");
+    printf("                                      Supported values: rgi, png, h (default: rgi)\n");
+    printf("    -j, --jobs <n>                  : Number of files converted concurrently (default: 1)\n");
+    printf("    --png-filter <type>             : PNG scanlines filter type, fixed filter for faster saving.\n");
+    printf("                                      Supported values: adaptive, none, sub, up, average, paeth\n");
+    printf("                                      NOTE: If not specified, defaults to: adaptive\n");
+    printf("    --compression <level>           : PNG compression profile or deflate level (0-9).\n");
+    printf("                                      Supported values: fast, default, max, 0..9 (9 same as max)\n");
+    printf("                                      NOTE: If not specified, defaults to: default\n");
+#if defined(RPNG_THREADS)
+    printf("    --png-threads <n>               : Threads used to compress one PNG image (default: %i)\n", PNG_EXPORT_THREADS);
+    printf("                                      NOTE: Only used for big images, output size barely changes\n");
+#endif
+    printf("    --code-format <layout>          : Code output layout (.h).\n");
+    printf("                                      Supported values: c, cpp (C++17 constexpr), blob (compressed)\n");
+    printf("                                      NOTE: If not specified, defaults to: c\n");
+    printf("    -t, --trim <file/dir> ...       : Trim iconset to icons used by sources: ICON_<name> ids and \"#NNN#\" markers.\n");
+    printf("                                      Directories scanned recursively: .c, .h, .cpp, .hpp, .cc, .inl\n");
+    printf("                                      NOTE: Remap table (original id -> trimmed id) saved as <output>_remap.h\n");
+    printf("    -a, --atlas <format>            : Export icons atlas, pre-rasterized icons (single channel).\n");
+    printf("                                      Supported values: png, raw (8bit, no header)\n");
+    printf("                                      NOTE: Atlas saved as <output>_atlas.<format>, rectangles and UVs as <output>_atlas.h\n");
+    printf("    --atlas-scales <list>           : Icons atlas scales, comma separated, up to %i scales: 1..%i\n", RGI_ATLAS_MAX_SCALES, RGI_ATLAS_MAX_SCALE);
+    printf("                                      NOTE: If not specified, defaults to: 1\n");
+    printf("    --stats                         : Report encode time and output size for every file\n");
+    printf("    --fps-stats                     : GUI mode, report rendered vs skipped (idle) frames on exit,\n");
+    printf("                                      and icons panel cache redraws vs reuses\n");
+    printf("    --undo-budget <size>            : GUI mode, undo memory budget in KB (default: %i)\n\n", UNDO_MEMORY_BUDGET/1024);
 
     printf("\nEXAMPLES:\n\n");
     printf("    > rguiicons --input icons.rgi --output icons.png\n");
     printf("        Process <icons.rgi> to generate <icons.png>\n\n");
     printf("    > rguiicons --input icons.rgi --output ricons.h\n");
     printf("        Process <icons.rgi> to generate <ricons.h>\n\n");
+    printf("    > rguiicons --input icons.rgi --output icons.png --compression max --stats\n");
+    printf("        Process <icons.rgi> to generate <icons.png>, smallest output, reporting stats\n\n");
+    printf("    > rguiicons --input icons.rgi --output - --format png > icons.png\n");
+    printf("        Process <icons.rgi> to generate a .png image written to stdout\n\n");
+    printf("    > rguiicons --input icons.rgi --output ricons.h --trim src/ external/raygui.h\n");
+    printf("        Process <icons.rgi> to generate <ricons.h> and <ricons_remap.h>,\n");
+    printf("        only icons used by <src> sources and <raygui.h> are kept\n\n");
+    printf("    > rguiicons --input icons.rgi --output ricons.h --atlas png --atlas-scales 1,2\n");
+    printf("        Process <icons.rgi> to generate <ricons.h>, icons atlas <ricons_atlas.png>\n");
+    printf("        with icons at 1x and 2x scales and its rectangles and UVs <ricons_atlas.h>\n\n");
+    printf("    > rguiicons --input packs/ extra/*.rgi --output-dir out --format png --jobs 8\n");
+    printf("        Process all .rgi files in <packs> and matching <extra/*.rgi>,\n");
+    printf("        generating .png files in <out> directory, using 8 workers\n\n");
 }
 
 // Process command line input
@@ -1578,6 +1855,20 @@ static void ProcessCommandLine(int argc, char *argv[])
 {
     // CLI required variables
     bool showUsageInfo = false;         // Toggle command line usage info
+    char outDirectory[512] = { 0 };     // Output directory (batch mode)
+    int outFormat = -1;                 // Output format (batch mode), -1 if not defined
+    int workers = 1;                    // Number of workers to process conversions
+    int compressionLevel = COMPRESSION_LEVEL_DEFAULT;   // PNG deflate compression level
+    bool showStats = false;             // Report conversion stats: encode time and output size
+    int codeFormat = RGI_CODE_FORMAT_C; // Code output layout
+    bool trimIcons = false;             // Trim iconsets to icons used by sources
+    IconsUsageSources sources = { 0 };  // Icons usage source files
+    int atlasFormat = ATLAS_FORMAT_NONE;    // Icons atlas output format
+    int atlasScales[RGI_ATLAS_MAX_SCALES] = { 1 };  // Icons atlas scales
+    int atlasScaleCount = 1;
+
+    ConvertJob *jobs = NULL;            // Conversion jobs, one per input file
+    int jobCount = 0;
 
     if (argc == 1) showUsageInfo = true;
 
@@ -1593,21 +1884,25 @@ static void ProcessCommandLine(int argc, char *argv[])
             // Check for valid upcoming argument
             if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
             {
-                // Check for valid file extension: input
-                if (IsFileExtension(argv[i + 1], ".rgi"))
+                // Read all input files until next option
+                while (((i + 1) < argc) && (argv[i + 1][0] != '-'))
                 {
-                    strcpy(inFileName, argv[i + 1]);    // Read input file
+                    AddInputFiles(&jobs, &jobCount, argv[i + 1]);
+                    i++;
                 }
-                else printf("WARNING: Input file extension not recognized.\n");
-
-                i++;
             }
             else printf("WARNING: No input file provided\n");
         }
         else if ((strcmp(argv[i], "-o") == 0) || (strcmp(argv[i], "--output") == 0))
         {
             // Check for valid upcoming argumment and valid file extension: output
-            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            // NOTE: Output '-' is stdout, output format defined by --format
+            if (((i + 1) < argc) && (strcmp(argv[i + 1], "-") == 0))
+            {
+                strcpy(outFileName, "-");
+                i++;
+            }
+            else if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
             {
                 // Check for valid file extension: output
                 if (IsFileExtension(argv[i + 1], ".rgi") ||
@@ -1622,395 +1917,1297 @@ static void ProcessCommandLine(int argc, char *argv[])
             }
             else printf("WARNING: No output file provided\n");
         }
-    }
-
-    // Process input file if provided
-    if (inFileName[0] != '\0')
-    {
-        // Set a default name for output in case not provided
-        if (outFileName[0] == '\0') strcpy(outFileName, "output.rgi");
-
-        printf("\nInput file:       %s", inFileName);
-        printf("\nOutput file:      %s", outFileName);
-
-        // Load input file: icons data and name ids
-        char **tempIconsName = GuiLoadIcons(inFileName, true);
-        memcpy(currentIcons, guiIcons, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
-        for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++) { strcpy(guiIconsName[i], tempIconsName[i]); RAYGUI_FREE(tempIconsName[i]); }
-        RAYGUI_FREE(tempIconsName);
-
-        // Process input --> output
-        if (IsFileExtension(outFileName, ".rgi")) SaveIcons(outFileName);
-        else if (IsFileExtension(outFileName, ".png"))
-        {
-            Image image = GenImageFromIconData(currentIcons, RAYGUI_ICON_MAX_ICONS, 16, 1);
-            ExportImage(image, outFileName);
-            UnloadImage(image);
-
-            // Concatenate all icons names into one string
-            char *iconsNames = (char *)RL_CALLOC(RAYGUI_ICON_MAX_ICONS*32, 1);
-            char *iconsNamesPtr = iconsNames;
-            for (int i = 0, size = 0; i < RAYGUI_ICON_MAX_ICONS; i++)
+        else if ((strcmp(argv[i], "-d") == 0) || (strcmp(argv[i], "--output-dir") == 0))
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
             {
-                size = strlen(guiIconsName[i]);
-                memcpy(iconsNamesPtr, guiIconsName[i], size);
-                iconsNamesPtr[size] = ';';
-                iconsNamesPtr += (size + 1);
+                strncpy(outDirectory, argv[i + 1], sizeof(outDirectory) - 1);
+                i++;
             }
+            else printf("WARNING: No output directory provided\n");
+        }
+        else if ((strcmp(argv[i], "-f") == 0) || (strcmp(argv[i], "--format") == 0))
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                if (strcmp(argv[i + 1], "rgi") == 0) outFormat = OUTPUT_FORMAT_RGI;
+                else if (strcmp(argv[i + 1], "png") == 0) outFormat = OUTPUT_FORMAT_PNG;
+                else if (strcmp(argv[i + 1], "h") == 0) outFormat = OUTPUT_FORMAT_CODE;
+                else printf("WARNING: Output format not recognized.\n");
 
-            // Save icons name id into PNG zTXt chunk
-            rpng_chunk_write_comp_text(outFileName, "Description", iconsNames);
-            RL_FREE(iconsNames);
+                i++;
+            }
+            else printf("WARNING: No output format provided\n");
         }
-        else if (IsFileExtension(outFileName, ".h")) ExportIconsAsCode(outFileName);
-    }
+        else if ((strcmp(argv[i], "-j") == 0) || (strcmp(argv[i], "--jobs") == 0))
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                int value = TextToInteger(argv[i + 1]);
 
-    if (showUsageInfo) ShowCommandLineInfo();
-}
-#endif // PLATFORM_DESKTOP
+                if ((value > 0) && (value <= MAX_BATCH_WORKERS)) workers = value;
+                else printf("WARNING: Number of jobs not valid, supported range: [1..%i]\n", MAX_BATCH_WORKERS);
 
-//--------------------------------------------------------------------------------------------
-// Load/Save/Export data functions
-//--------------------------------------------------------------------------------------------
+                i++;
+            }
+            else printf("WARNING: No number of jobs provided\n");
+        }
+        else if (strcmp(argv[i], "--png-filter") == 0)
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                const char *filters[6] = { "adaptive", "none", "sub", "up", "average", "paeth" };
+                int filter = -1;
 
-// Load icons from image file
-// NOTE: Several parameters are required for proper loading
-static void LoadIconsFromImage(Image image, int iconCount, int iconSize, int iconsPerLine, int padding)
-{
-    int lines = iconCount/iconsPerLine;
-    if (iconCount%iconsPerLine > 0) lines++;
+                for (int k = 0; k < 6; k++) if (strcmp(argv[i + 1], filters[k]) == 0) filter = k;
+
+                // NOTE: Filter type set before conversions, used by all workers
+                if (filter != -1) rpng_set_filter_type(RPNG_FILTER_ADAPTIVE + filter);
+                else printf("WARNING: PNG filter type not recognized.\n");
 
-    Color *pixels = LoadImageColors(image);
+                i++;
+            }
+            else printf("WARNING: No PNG filter type provided\n");
+        }
+        else if (strcmp(argv[i], "--compression") == 0)
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                const char *value = argv[i + 1];
 
-    Rectangle icorec = { 0, 0, iconSize, iconSize };
-    Color pixel = BLACK;
+                if (strcmp(value, "fast") == 0) compressionLevel = COMPRESSION_LEVEL_FAST;
+                else if (strcmp(value, "default") == 0) compressionLevel = COMPRESSION_LEVEL_DEFAULT;
+                else if (strcmp(value, "max") == 0) compressionLevel = COMPRESSION_LEVEL_MAX;
+                else if ((value[0] >= '0') && (value[0] <= '9') && (value[1] == '\0'))
+                {
+                    // NOTE: Deflate levels supported by rpng are [0..8], level 9 maps to max
+                    compressionLevel = value[0] - '0';
+                    if (compressionLevel > RPNG_COMPRESSION_LEVEL_MAX) compressionLevel = RPNG_COMPRESSION_LEVEL_MAX;
+                }
+                else printf("WARNING: Compression level not recognized.\n");
 
-    // Calculate number of bytes required
-    int size = iconsPerLine*lines*iconSize*iconSize/32;
-    unsigned int *values = (unsigned int *)calloc(size, sizeof(unsigned int));
+                i++;
+            }
+            else printf("WARNING: No compression level provided\n");
+        }
+        else if (strcmp(argv[i], "--png-threads") == 0)
+        {
+        #if defined(RPNG_THREADS)
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                int value = TextToInteger(argv[i + 1]);
 
-    int n = 0;      // Icons counter
-    int k = 0;      // Bit counter
+                // NOTE: Threads count set before conversions, used by all workers
+                if ((value > 0) && (value <= RPNG_MAX_THREADS)) rpng_set_thread_count(value);
+                else printf("WARNING: Number of PNG threads not valid, supported range: [1..%i]\n", RPNG_MAX_THREADS);
 
-    for (int y = 0; y < lines; y++)
-    {
-        for (int x = 0; x < iconsPerLine; x++)
+                i++;
+            }
+            else printf("WARNING: No number of PNG threads provided\n");
+        #else
+            // NOTE: Value skipped, PNG images always compressed by one thread on this build
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-')) i++;
+            printf("WARNING: PNG compression threads not supported on this build, option ignored\n");
+        #endif
+        }
+        else if (strcmp(argv[i], "--code-format") == 0)
         {
-            // Get icon start pixel position within image (top-left corner)
-            icorec.x = padding + x*(iconSize + 2*padding);
-            icorec.y = padding + y*(iconSize + 2*padding);
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                if (strcmp(argv[i + 1], "c") == 0) codeFormat = RGI_CODE_FORMAT_C;
+                else if (strcmp(argv[i + 1], "cpp") == 0) codeFormat = RGI_CODE_FORMAT_CPP;
+                else if (strcmp(argv[i + 1], "blob") == 0) codeFormat = RGI_CODE_FORMAT_BLOB;
+                else printf("WARNING: Code output layout not recognized.\n");
 
-            // Move along pixels within each icon area
-            for (int p = 0; p < iconSize*iconSize; p++)
+                i++;
+            }
+            else printf("WARNING: No code output layout provided\n");
+        }
+        else if ((strcmp(argv[i], "-t") == 0) || (strcmp(argv[i], "--trim") == 0))
+        {
+            // Check for valid upcoming argument
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
             {
-                pixel = pixels[((int)icorec.y + p/iconSize)*(iconsPerLine*(iconSize + 2*padding)) + ((int)icorec.x + p%iconSize)];
+                // Read all sources until next option
+                while (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+                {
+                    AddUsageSources(&sources, argv[i + 1]);
+                    i++;
+                }
 
-                if (ColorToInt(pixel) == 0xffffffff) RGI_BIT_SET(values[n*(iconSize*iconSize/32) + p/32], k);
+                trimIcons = true;
+            }
+            else printf("WARNING: No sources provided to trim iconset\n");
+        }
+        else if ((strcmp(argv[i], "-a") == 0) || (strcmp(argv[i], "--atlas") == 0))
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                if (strcmp(argv[i + 1], "png") == 0) atlasFormat = ATLAS_FORMAT_PNG;
+                else if (strcmp(argv[i + 1], "raw") == 0) atlasFormat = ATLAS_FORMAT_RAW;
+                else printf("WARNING: Icons atlas format not recognized.\n");
 
-                k++;
-                if (k == 32) k = 0;
+                i++;
             }
+            else printf("WARNING: No icons atlas format provided\n");
+        }
+        else if (strcmp(argv[i], "--atlas-scales") == 0)
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                int count = 0;
+                char **values = TextSplit(argv[i + 1], ',', &count);
+                bool valid = ((count > 0) && (count <= RGI_ATLAS_MAX_SCALES));
 
-            n++;
+                for (int k = 0; valid && (k < count); k++)
+                {
+                    int scale = TextToInteger(values[k]);
+                    if ((scale >= 1) && (scale <= RGI_ATLAS_MAX_SCALE)) atlasScales[k] = scale;
+                    else valid = false;
+                }
+
+                if (valid) atlasScaleCount = count;
+                else
+                {
+                    atlasScales[0] = 1;
+                    atlasScaleCount = 1;
+                    printf("WARNING: Icons atlas scales not valid, up to %i scales supported: [1..%i]\n", RGI_ATLAS_MAX_SCALES, RGI_ATLAS_MAX_SCALE);
+                }
+
+                i++;
+            }
+            else printf("WARNING: No icons atlas scales provided\n");
         }
+        else if (strcmp(argv[i], "--stats") == 0) showStats = true;
     }
 
-    UnloadImageColors(pixels);
-    UnloadImage(image);
-}
+    // NOTE: Compression level set before conversions, used by all workers
+    rpng_set_compression_level(compressionLevel);
 
-// Save raygui icons file (.rgi)
-static int SaveIcons(const char *fileName)
-{
-    // raygui Icons File Structure (.rgi)
-    // ------------------------------------------------------
-    // Offset  | Size    | Type       | Description
-    // ------------------------------------------------------
-    // 0       | 4       | char       | Signature: "rGI "
-    // 4       | 2       | short      | Version: 100, 500 (raygui 5.0)
-    // 6       | 2       | short      | reserved
-
-    // 8       | 2       | short      | Num icons (N)
-    // 10      | 2       | short      | Icons size (Options: 16, 32, 64)
-
-    // Icons name id (32 bytes per name id)
-    // foreach (icon)
-    // {
-    //   12+32*i  | 32   | char       | Icon NameId (RAYGUI_ICON_MAX_NAME_LENGTH)
-    // }
-
-    // Icons data: One bit per pixel, stored as unsigned int array (depends on icon size)
-    // S*S pixels/32bit per unsigned int = K unsigned int per icon
-    // foreach (icon)
-    // {
-    //   ...   | K       | unsigned int | Icon Data
-    // }
-
-    int result = -1;
-    FILE *rgiFile = fopen(fileName, "wb");
-
-    if (rgiFile != NULL)
+    // Process input files if provided
+    if (jobCount > 0)
     {
-        // WARNING: Version 500 is aligned with raygui 5.0,
-        // up to 512 icons vs 256 on previous versions
-        char signature[5] = "rGI ";
-        short version = 500;
-        short reserved = 0;
-        short iconCount = RAYGUI_ICON_MAX_ICONS;
-        short iconSize = RAYGUI_ICON_SIZE;
-
-        fwrite(signature, sizeof(char), 4, rgiFile);
-        fwrite(&version, sizeof(short), 1, rgiFile);
-        fwrite(&reserved, sizeof(short), 1, rgiFile);
-        fwrite(&iconCount, sizeof(short), 1, rgiFile);
-        fwrite(&iconSize, sizeof(short), 1, rgiFile);
+        bool batchMode = ((jobCount > 1) || (outDirectory[0] != '\0') || (outFormat != -1));
+        bool toStdout = (strcmp(outFileName, "-") == 0);
 
-        for (int i = 0; i < iconCount; i++)
+        if (toStdout && (jobCount > 1))
         {
-            // Write icons name id
-            fwrite(guiIconsName[i], 1, RAYGUI_ICON_MAX_NAME_LENGTH, rgiFile);
+            printf("ERROR: Output to stdout only supported for a single input file\n");
+            RL_FREE(jobs);
+            UnloadUsageSources(&sources);
+            return;
         }
 
-        for (int i = 0; i < iconCount; i++)
+        if ((trimIcons || (atlasFormat != ATLAS_FORMAT_NONE)) && toStdout)
         {
-            // Write icons data
-            fwrite(GetIconData(currentIcons, i), sizeof(unsigned int), (iconSize*iconSize/32), rgiFile);
+            printf("ERROR: Iconset trimming and icons atlas require an output file, saved along it\n");
+            RL_FREE(jobs);
+            UnloadUsageSources(&sources);
+            return;
         }
 
-        fclose(rgiFile);
-        result = 0;
-    }
+        if (trimIcons && (sources.count == 0))
+        {
+            printf("ERROR: No sources could be loaded to trim iconset\n");
+            RL_FREE(jobs);
+            UnloadUsageSources(&sources);
+            return;
+        }
 
-    return result;
-}
+        if (toStdout)
+        {
+            strcpy(jobs[0].outFileName, outFileName);
+            jobs[0].format = (outFormat != -1)? outFormat : OUTPUT_FORMAT_RGI;
+        #if defined(_WIN32)
+            _setmode(_fileno(stdout), _O_BINARY);
+        #endif
+        }
+        else if (!batchMode || ((jobCount == 1) && (outFileName[0] != '\0')))
+        {
+            // Set a default name for output in case not provided
+            if (outFileName[0] == '\0') strcpy(outFileName, "output.rgi");
 
-// Export gui icons as code (.h)
-static void ExportIconsAsCode(const char *fileName)
-{
-    FILE *codeFile = fopen(fileName, "wt");
+            strcpy(jobs[0].outFileName, outFileName);
+            if (IsFileExtension(outFileName, ".png")) jobs[0].format = OUTPUT_FORMAT_PNG;
+            else if (IsFileExtension(outFileName, ".h")) jobs[0].format = OUTPUT_FORMAT_CODE;
+            else jobs[0].format = OUTPUT_FORMAT_RGI;
+        }
+        else
+        {
+            if (outFileName[0] != '\0') printf("WARNING: Output file ignored for multiple input files, use --output-dir\n");
+            if (outFormat == -1) outFormat = OUTPUT_FORMAT_RGI;
 
-    if (codeFile != NULL)
-    {
-        fprintf(codeFile, "//////////////////////////////////////////////////////////////////////////////////\n");
-        fprintf(codeFile, "//                                                                              //\n");
-        fprintf(codeFile, "// raygui Icons exporter v1.1 - Icons data exported as a values array           //\n");
-        fprintf(codeFile, "//                                                                              //\n");
-        fprintf(codeFile, "// more info and bugs-report:  github.com/raysan5/raygui                        //\n");
-        fprintf(codeFile, "// feedback and support:       ray[at]raylibtech.com                            //\n");
-        fprintf(codeFile, "//                                                                              //\n");
-        fprintf(codeFile, "// Copyright (c) 2019-2026 raylib technologies (@raylibtech)                    //\n");
-        fprintf(codeFile, "//                                                                              //\n");
-        fprintf(codeFile, "//////////////////////////////////////////////////////////////////////////////////\n\n");
-
-        fprintf(codeFile, "//----------------------------------------------------------------------------------\n");
-        fprintf(codeFile, "// Defines and Macros\n");
-        fprintf(codeFile, "//----------------------------------------------------------------------------------\n");
-        fprintf(codeFile, "#define RAYGUI_ICON_SIZE             %i   // Size of icons (squared)\n", RAYGUI_ICON_SIZE);
-        fprintf(codeFile, "#define RAYGUI_ICON_MAX_ICONS       %i   // Maximum number of icons\n", RAYGUI_ICON_MAX_ICONS);
-        fprintf(codeFile, "#define RAYGUI_ICON_MAX_NAME_LENGTH  %i   // Maximum length of icon name id\n\n", RAYGUI_ICON_MAX_NAME_LENGTH);
-
-        fprintf(codeFile, "// Icons data is defined by bit array (every bit represents one pixel)\n");
-        fprintf(codeFile, "// Those arrays are stored as unsigned int data arrays, so every array\n");
-        fprintf(codeFile, "// element defines 32 pixels (bits) of information\n");
-        fprintf(codeFile, "// Number of elemens depend on RAYGUI_ICON_SIZE (by default 16x16 pixels)\n");
-        fprintf(codeFile, "#define RAYGUI_ICON_DATA_ELEMENTS   (RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE/32)\n\n");
-
-        fprintf(codeFile, "//----------------------------------------------------------------------------------\n");
-        fprintf(codeFile, "// Icons enumeration\n");
-        fprintf(codeFile, "//----------------------------------------------------------------------------------\n");
-
-        fprintf(codeFile, "typedef enum {\n");
-        for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++) fprintf(codeFile, "    ICON_%-24s = %i,\n", (guiIconsName[i][0] != '\0')? guiIconsName[i] : TextFormat("%03i", i), i);
-        fprintf(codeFile, "} guiIconName;\n\n");
-
-        fprintf(codeFile, "//----------------------------------------------------------------------------------\n");
-        fprintf(codeFile, "// Icons data\n");
-        fprintf(codeFile, "//----------------------------------------------------------------------------------\n");
-
-        fprintf(codeFile, "static unsigned int guiIcons[RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS] = {\n");
-        for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++)
-        {
-            unsigned int *icon = GetIconData(currentIcons, i);
-
-            fprintf(codeFile, "    ");
-            for (int j = 0; j < RAYGUI_ICON_DATA_ELEMENTS; j++) fprintf(codeFile, "0x%08x, ", icon[j]);
-
-            fprintf(codeFile, "     // ICON_%s\n", (guiIconsName[i][0] != '\0')? guiIconsName[i] : TextFormat("%03i", i));
-        }
-        fprintf(codeFile, "};\n\n");
-
-        fprintf(codeFile, "// NOTE: A pointer to the current icons array should be defined\n");
-        fprintf(codeFile, "static unsigned int *guiIconsPtr = guiIcons;\n");
-
-        fclose(codeFile);
-    }
-}
+            if ((outDirectory[0] != '\0') && !DirectoryExists(outDirectory) && (MakeDirectory(outDirectory) != 0))
+            {
+                printf("ERROR: Output directory could not be created: %s\n", outDirectory);
+                RL_FREE(jobs);
+                UnloadUsageSources(&sources);
+                return;
+            }
 
-//--------------------------------------------------------------------------------------------
-// Auxiliar functions
-//--------------------------------------------------------------------------------------------
+            // Resolve output file names: <outDirectory>/<inputName>.<format>
+            // NOTE: Output directory defaults to input file directory
+            const char *extensions[3] = { "rgi", "png", "h" };
 
-// Draw selected icon from iconset
-static void DrawIcon(unsigned int *iconset, int iconId, int posX, int posY, int pixelSize, Color color)
-{
-    for (int i = 0, y = 0; i < RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE/32; i++)
-    {
-        for (int k = 0; k < 32; k++)
-        {
-            if (RGI_BIT_CHECK(iconset[iconId*RAYGUI_ICON_DATA_ELEMENTS + i], k))
+            for (int i = 0; i < jobCount; i++)
             {
-                // NOTE: Drawing the icon pixel-by-pixel using rectangles
-                DrawRectangle(posX + (k%RAYGUI_ICON_SIZE)*pixelSize, posY + y*pixelSize, pixelSize, pixelSize, color);
-            }
+                if (jobs[i].error[0] != '\0') continue;
+
+                int length = snprintf(jobs[i].outFileName, sizeof(jobs[i].outFileName), "%s/%s.%s",
+                    (outDirectory[0] != '\0')? outDirectory : GetDirectoryPath(jobs[i].inFileName),
+                    GetFileNameWithoutExt(jobs[i].inFileName), extensions[outFormat]);
+                jobs[i].format = outFormat;
 
-            if ((k == 15) || (k == 31)) y++;
+                if ((length < 0) || (length >= (int)sizeof(jobs[i].outFileName))) strcpy(jobs[i].error, "Output file name too long");
+                else if (strcmp(jobs[i].outFileName, jobs[i].inFileName) == 0) strcpy(jobs[i].error, "Output file is the same as input file");
+            }
         }
-    }
-}
 
-// Draw one icon directly providing the full icon data
-static void DrawIconData(unsigned int *data, int x, int y, int pixelSize, Color color)
-{
-    //#define RGI_BIT_CHECK(a,b) ((a) & (1<<(b)))
+        for (int i = 0; i < jobCount; i++) jobs[i].codeFormat = codeFormat;
 
-    for (int i = 0, j = 0; i < RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE/32; i++)
-    {
-        for (int k = 0; k < 32; k++)
+        // Resolve remap table file names: <outputDirectory>/<outputName>_remap.h
+        if (trimIcons)
         {
-            if (RGI_BIT_CHECK(data[i], k))
+            for (int i = 0; i < jobCount; i++)
             {
-                // NOTE: Drawing the icon pixel-by-pixel using rectangles
-                DrawRectangle(x + (k%RAYGUI_ICON_SIZE)*pixelSize, y + j*pixelSize, pixelSize, pixelSize, color);
-            }
+                if (jobs[i].error[0] != '\0') continue;
 
-            if ((k == 15) || (k == 31)) j++;
+                int length = snprintf(jobs[i].remapFileName, sizeof(jobs[i].remapFileName), "%s/%s_remap.h",
+                    GetDirectoryPath(jobs[i].outFileName), GetFileNameWithoutExt(jobs[i].outFileName));
+                jobs[i].usageSources = &sources;
+
+                if ((length < 0) || (length >= (int)sizeof(jobs[i].remapFileName))) strcpy(jobs[i].error, "Remap file name too long");
+            }
         }
-    }
-}
 
-// Gen GRAYSCALE image from and array of bits stored as int (0-BLANK, 1-WHITE)
-static Image GenImageFromIconData(unsigned int *icons, int iconCount, int iconsPerLine, int padding)
-{
-    //#define RGI_BIT_CHECK(a,b) ((a) & (1<<(b)))
+        // Resolve icons atlas file names: <outputDirectory>/<outputName>_atlas.<format> and <outputName>_atlas.h
+        if (atlasFormat != ATLAS_FORMAT_NONE)
+        {
+            for (int i = 0; i < jobCount; i++)
+            {
+                if (jobs[i].error[0] != '\0') continue;
 
-    Image image = { 0 };
+                const char *outDirPath = GetDirectoryPath(jobs[i].outFileName);
+                const char *outName = GetFileNameWithoutExt(jobs[i].outFileName);
+                int length = snprintf(jobs[i].atlasFileName, sizeof(jobs[i].atlasFileName), "%s/%s_atlas.%s",
+                    outDirPath, outName, (atlasFormat == ATLAS_FORMAT_PNG)? "png" : "raw");
+                int codeLength = snprintf(jobs[i].atlasCodeFileName, sizeof(jobs[i].atlasCodeFileName), "%s/%s_atlas.h", outDirPath, outName);
 
-    int lines = iconCount/iconsPerLine;
-    if (iconCount%iconsPerLine > 0) lines++;
+                jobs[i].atlasFormat = atlasFormat;
+                memcpy(jobs[i].atlasScales, atlasScales, sizeof(atlasScales));
+                jobs[i].atlasScaleCount = atlasScaleCount;
 
-    image.width = (RAYGUI_ICON_SIZE + 2*padding)*iconsPerLine;
-    image.height = (RAYGUI_ICON_SIZE + 2*padding)*lines;
-    image.mipmaps = 1;
-    image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-    image.data = (unsigned char *)calloc(image.width*image.height, 1);  // All pixels BLACK by default
+                if ((length < 0) || (length >= (int)sizeof(jobs[i].atlasFileName)) ||
+                    (codeLength < 0) || (codeLength >= (int)sizeof(jobs[i].atlasCodeFileName))) strcpy(jobs[i].error, "Atlas file name too long");
+            }
+        }
 
-    int pixelX = 0;
-    int pixelY = 0;
+        // Check output files are not shared with previous jobs (i.e. same input name from several
+        // directories, same input file provided twice), workers would write the same file at once
+        for (int i = 1; i < jobCount; i++)
+        {
+            if (jobs[i].error[0] != '\0') continue;
 
-    for (int n = 0; n < iconCount; n++)
-    {
-        for (int i = 0, y = 0; i < RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE/32; i++)
+            for (int k = 0; k < i; k++)
+            {
+                if ((jobs[k].error[0] == '\0') && IsJobOutputShared(&jobs[i], &jobs[k]))
+                {
+                    snprintf(jobs[i].error, sizeof(jobs[i].error), "Output file already written from input: %.64s", jobs[k].inFileName);
+                    break;
+                }
+            }
+        }
+
+        ConvertBatch batch = { 0 };
+        batch.jobs = jobs;
+        batch.jobCount = jobCount;
+
+        ProcessConvertBatch(&batch, workers);
+
+        // Report conversion results, errors collected at the end
+        // NOTE: Report goes to stderr when output data is written to stdout
+        FILE *report = toStdout? stderr : stdout;
+        int convertedCount = 0;
+        double totalEncodeTime = 0.0;
+        long long totalOutputSize = 0;
+
+        for (int i = 0; i < jobCount; i++)
         {
-            for (int k = 0; k < 32; k++)
+            if (jobs[i].success)
             {
-                pixelX = padding + (n%iconsPerLine)*(RAYGUI_ICON_SIZE + 2*padding) + (k%RAYGUI_ICON_SIZE);
-                pixelY = padding + (n/iconsPerLine)*(RAYGUI_ICON_SIZE + 2*padding) + y;
+                fprintf(report, "\nInput file:       %s", jobs[i].inFileName);
+                fprintf(report, "\nOutput file:      %s", toStdout? "stdout" : jobs[i].outFileName);
+
+                if (trimIcons)
+                {
+                    fprintf(report, "\nRemap file:       %s", jobs[i].remapFileName);
+                    fprintf(report, "\nIcons used:       %i/%i", jobs[i].trimmedCount, jobs[i].iconCount);
+                }
 
-                if (RGI_BIT_CHECK(icons[n*RAYGUI_ICON_DATA_ELEMENTS + i], k)) ((unsigned char *)image.data)[pixelY*image.width + pixelX] = 0xff;    // Draw pixel WHITE
+                if (atlasFormat != ATLAS_FORMAT_NONE)
+                {
+                    fprintf(report, "\nAtlas file:       %s", jobs[i].atlasFileName);
+                    fprintf(report, "\nAtlas UVs file:   %s", jobs[i].atlasCodeFileName);
+                }
 
-                if ((k == (RAYGUI_ICON_SIZE - 1)) || (k == 31)) y++;  // Move to next pixels line
+                if (showStats)
+                {
+                    fprintf(report, "\nEncode time:      %.3f ms", jobs[i].encodeTime*1000.0);
+                    fprintf(report, "\nOutput size:      %i bytes", jobs[i].outputSize);
+                    totalEncodeTime += jobs[i].encodeTime;
+                    totalOutputSize += jobs[i].outputSize;
+                }
+
+                convertedCount++;
+            }
+        }
+
+        fprintf(report, "\n\nFiles converted:  %i/%i\n", convertedCount, jobCount);
+
+        if (showStats)
+        {
+            fprintf(report, "Compression:      level %i\n", compressionLevel);
+            fprintf(report, "Encode time:      %.3f ms (total)\n", totalEncodeTime*1000.0);
+            fprintf(report, "Output size:      %lli bytes (total)\n", totalOutputSize);
+        }
+
+        if (convertedCount < jobCount)
+        {
+            fprintf(report, "\nERRORS:\n\n");
+            for (int i = 0; i < jobCount; i++)
+            {
+                if (!jobs[i].success) fprintf(report, "    %s: %s\n", jobs[i].inFileName, jobs[i].error);
             }
         }
     }
 
-    return image;
+    RL_FREE(jobs);
+    UnloadUsageSources(&sources);
+
+    if (showUsageInfo) ShowCommandLineInfo();
 }
 
-// Converts an image to bits array following: Alpha->0, NoAlpha->1
-// Very useful to store 1bit color images in an efficient (and quite secure) way
-// NOTE: Image size MUST be multiple of 8 for correct fit
-static unsigned char *ImageToBits(Image image)
+// Add input files as conversion jobs: file, directory or wildcards pattern
+// NOTE: Directories are scanned for .rgi files (not recursive), patterns are matched
+// against file names in pattern directory, inputs not found are added as failed jobs
+static void AddInputFiles(ConvertJob **jobs, int *jobCount, const char *input)
 {
-    Color *pixels = LoadImageColors(image);
+    FilePathList files = { 0 };
+    const char *pattern = NULL;
 
-    // Calculate number of bytes required
-    int size = image.width*image.height/8;
+    if (DirectoryExists(input)) files = LoadDirectoryFilesEx(input, ".rgi", false);
+    else if ((strchr(input, '*') != NULL) || (strchr(input, '?') != NULL))
+    {
+        pattern = GetFileName(input);
+        files = LoadDirectoryFilesEx(GetDirectoryPath(input), ".rgi", false);
+    }
 
-    unsigned char *bytes = (unsigned char *)calloc(size, sizeof(unsigned char));
+    int addedCount = 0;
 
-    for (int i = 0; i < size; i++)
+    for (unsigned int i = 0; i < ((files.paths != NULL)? files.count : 1); i++)
     {
-        for (int k = 0; k < 8; k++)
+        const char *fileName = (files.paths != NULL)? files.paths[i] : input;
+
+        if ((pattern != NULL) && !IsFileNameMatch(GetFileName(fileName), pattern)) continue;
+
+        ConvertJob *newJobs = (ConvertJob *)RL_REALLOC(*jobs, (*jobCount + 1)*sizeof(ConvertJob));
+        if (newJobs == NULL) break;
+
+        *jobs = newJobs;
+        ConvertJob *job = &newJobs[*jobCount];
+        memset(job, 0, sizeof(ConvertJob));
+        strncpy(job->inFileName, fileName, sizeof(job->inFileName) - 1);
+
+        if (files.paths == NULL)
         {
-            if (ColorToInt(pixels[i]) >= 0x000000ff) RGI_BIT_SET(bytes[i + k], k);
+            if (!FileExists(fileName)) strcpy(job->error, "Input file not found");
+            else if (!IsFileExtension(fileName, ".rgi")) strcpy(job->error, "Input file extension not recognized");
         }
+
+        (*jobCount)++;
+        addedCount++;
     }
 
-    UnloadImageColors(pixels);
+    if ((pattern != NULL) && (addedCount == 0)) printf("WARNING: No input files matching: %s\n", input);
 
-    return bytes;
+    if (files.paths != NULL) UnloadDirectoryFiles(files);
 }
 
-// Generate color-alpha image from and array of bits, stored in bytes
-// NOTE: 0-BLANK, 1-color
-static Image GenImageFromBits(unsigned char *bytes, int width, int height, Color color)
+// Add icons usage source files: file or directory (recursive)
+// NOTE: Sources text is loaded in advance, workers scan it without any raylib function call
+static void AddUsageSources(IconsUsageSources *sources, const char *input)
 {
-    Image image = { 0 };
+    FilePathList files = { 0 };
+
+    if (DirectoryExists(input)) files = LoadDirectoryFilesEx(input, ".c;.h;.cpp;.hpp;.cc;.inl", true);
+    else if (!FileExists(input))
+    {
+        printf("WARNING: Source file or directory not found: %s\n", input);
+        return;
+    }
+
+    for (unsigned int i = 0; i < ((files.paths != NULL)? files.count : 1); i++)
+    {
+        const char *fileName = (files.paths != NULL)? files.paths[i] : input;
+
+        char **newTexts = (char **)RL_REALLOC(sources->texts, (sources->count + 1)*sizeof(char *));
+        if (newTexts != NULL) sources->texts = newTexts;
+        int *newSizes = (int *)RL_REALLOC(sources->sizes, (sources->count + 1)*sizeof(int));
+        if (newSizes != NULL) sources->sizes = newSizes;
+        if ((newTexts == NULL) || (newSizes == NULL)) break;
+
+        char *text = LoadFileText(fileName);
+
+        if (text != NULL)
+        {
+            sources->texts[sources->count] = text;
+            sources->sizes[sources->count] = (int)strlen(text);
+            sources->count++;
+        }
+    }
+
+    if (files.paths != NULL) UnloadDirectoryFiles(files);
+}
+
+// Unload icons usage source files
+static void UnloadUsageSources(IconsUsageSources *sources)
+{
+    for (int i = 0; i < sources->count; i++) UnloadFileText(sources->texts[i]);
+
+    RL_FREE(sources->texts);
+    RL_FREE(sources->sizes);
+    *sources = (IconsUsageSources){ 0 };
+}
+
+// Check conversion jobs share any output file: output file, remap table, icons atlas files
+static bool IsJobOutputShared(const ConvertJob *job, const ConvertJob *other)
+{
+    const char *files[4] = { job->outFileName, job->remapFileName, job->atlasFileName, job->atlasCodeFileName };
+    const char *otherFiles[4] = { other->outFileName, other->remapFileName, other->atlasFileName, other->atlasCodeFileName };
+
+    for (int i = 0; i < 4; i++)
+    {
+        if (files[i][0] == '\0') continue;
+
+        for (int k = 0; k < 4; k++)
+        {
+            if (strcmp(files[i], otherFiles[k]) == 0) return true;
+        }
+    }
+
+    return false;
+}
+
+// Check file name matches wildcards pattern
+// NOTE: Supported wildcards: '*' (any characters sequence) and '?' (any character)
+static bool IsFileNameMatch(const char *fileName, const char *pattern)
+{
+    const char *star = NULL;        // Last '*' found in pattern
+    const char *starMatch = NULL;   // File name position matched by last '*'
+
+    while (*fileName != '\0')
+    {
+        if ((*pattern == '?') || (*pattern == *fileName)) { pattern++; fileName++; }
+        else if (*pattern == '*') { star = pattern++; starMatch = fileName; }
+        else if (star != NULL) { pattern = star + 1; fileName = ++starMatch; }
+        else return false;
+    }
+
+    while (*pattern == '*') pattern++;
+
+    return (*pattern == '\0');
+}
+
+#if defined(SUPPORT_BATCH_WORKERS)
+// Conversion batch worker, processing jobs until none left
+static void *ConvertBatchWorker(void *data)
+{
+    ConvertBatch *batch = (ConvertBatch *)data;
+
+    while (true)
+    {
+        pthread_mutex_lock(&batch->mutex);
+        int index = batch->nextJob++;
+        pthread_mutex_unlock(&batch->mutex);
+
+        if (index >= batch->jobCount) break;
+
+        ConvertIconsFile(&batch->jobs[index]);
+    }
+
+    return NULL;
+}
+#endif
+
+// Process conversion jobs, using several workers if available
+// NOTE: Calling thread also works as one of the workers
+static void ProcessConvertBatch(ConvertBatch *batch, int workers)
+{
+#if defined(SUPPORT_BATCH_WORKERS)
+    if (workers > batch->jobCount) workers = batch->jobCount;
+
+    if (workers > 1)
+    {
+        pthread_t threads[MAX_BATCH_WORKERS] = { 0 };
+        int threadCount = 0;
+
+        pthread_mutex_init(&batch->mutex, NULL);
+
+        for (int i = 0; i < (workers - 1); i++)
+        {
+            if (pthread_create(&threads[threadCount], NULL, ConvertBatchWorker, batch) == 0) threadCount++;
+        }
+
+        ConvertBatchWorker(batch);
+
+        for (int i = 0; i < threadCount; i++) pthread_join(threads[i], NULL);
+
+        pthread_mutex_destroy(&batch->mutex);
+        return;
+    }
+#endif
+    for (int i = 0; i < batch->jobCount; i++) ConvertIconsFile(&batch->jobs[i]);
+}
+
+// Convert one iconset file
+// NOTE: Thread-safe, only rgi and rpng functions are used (no raylib functions or global state)
+static void ConvertIconsFile(ConvertJob *job)
+{
+    if (job->error[0] != '\0') return;      // Job already failed on input files checking
+
+    // NOTE: Input file is memory mapped, icons data and name ids are read directly from file data
+    rgi_iconset_file file = rgi_map_iconset(job->inFileName);
+    rgi_iconset iconset = file.iconset;
+
+    if (file.data == NULL)
+    {
+        strcpy(job->error, "Input file could not be loaded, not a valid iconset");
+        return;
+    }
+
+    // Trim iconset to icons used by sources, remap table translates original ids
+    // NOTE: Remap table is exported from original iconset, icons names ids required
+    rgi_iconset trimmed = { 0 };
+    int *remap = NULL;
+    job->iconCount = iconset.count;
+
+    if (job->usageSources != NULL)
+    {
+        bool *used = (bool *)RL_CALLOC(iconset.count, sizeof(bool));
+        remap = (int *)RL_CALLOC(iconset.count, sizeof(int));
+
+        if ((used != NULL) && (remap != NULL))
+        {
+            for (int i = 0; i < job->usageSources->count; i++) rgi_scan_icons_usage(iconset, job->usageSources->texts[i], job->usageSources->sizes[i], used);
+            trimmed = rgi_gen_iconset_trimmed(iconset, used, remap);
+        }
+
+        RL_FREE(used);
+
+        if (trimmed.count == 0)
+        {
+            strcpy(job->error, "Iconset could not be trimmed, no icons used by sources");
+            RL_FREE(remap);
+            rgi_unmap_iconset(file);
+            return;
+        }
+
+        job->trimmedCount = trimmed.count;
+        iconset = trimmed;
+    }
+
+    bool toStdout = (strcmp(job->outFileName, "-") == 0);
+    int result = RGI_SUCCESS;
+    double startTime = GetTimeCounter();
+
+    // NOTE: Output file data is generated in memory and written once (file or stdout)
+    // NOTE: PNG data is allocated by rpng, must be freed with RPNG_FREE (not raylib/rgi allocators)
+    char *data = NULL;
+    int dataSize = 0;
+    bool rpngData = (job->format == OUTPUT_FORMAT_PNG);
+
+    if (job->format == OUTPUT_FORMAT_PNG) data = ExportIconsImageToMemory(iconset, true, &dataSize);
+    else if (job->format == OUTPUT_FORMAT_CODE) data = rgi_export_iconset_as_code_to_memory(iconset, job->codeFormat, &dataSize);
+    else data = (char *)rgi_save_iconset_to_memory(iconset, &dataSize);
+
+    job->encodeTime = GetTimeCounter() - startTime;
+    job->outputSize = dataSize;
+
+    if ((data == NULL) || (dataSize <= 0)) result = RGI_ERROR_MEMORY_ALLOC;
+    else if (toStdout) result = ((fwrite(data, 1, dataSize, stdout) == (size_t)dataSize) && (fflush(stdout) == 0))? RGI_SUCCESS : RGI_ERROR_FILE_WRITE;
+    else result = rgi_save_file_data(job->outFileName, (const unsigned char *)data, dataSize);
+
+    if (rpngData) RPNG_FREE(data);
+    else RL_FREE(data);
+
+    if ((result == RGI_SUCCESS) && (remap != NULL))
+    {
+        data = rgi_export_icons_remap_as_code_to_memory(file.iconset, remap, &dataSize);
+
+        if (data != NULL) result = rgi_save_file_data(job->remapFileName, (const unsigned char *)data, dataSize);
+        else result = RGI_ERROR_MEMORY_ALLOC;
+
+        if (result != RGI_SUCCESS) strcpy(job->error, "Remap table file could not be saved");
+
+        RL_FREE(data);
+    }
+
+    // Export icons atlas, from trimmed iconset if required
+    if ((result == RGI_SUCCESS) && (job->atlasFormat != ATLAS_FORMAT_NONE))
+    {
+        int width = 0;
+        int height = 0;
+        unsigned char *atlas = rgi_gen_atlas_data(iconset, job->atlasScales, job->atlasScaleCount, ATLAS_CELL_PADDING, &width, &height);
+
+        if (atlas == NULL) result = RGI_ERROR_MEMORY_ALLOC;
+        else if (job->atlasFormat == ATLAS_FORMAT_PNG)
+        {
+            data = rpng_save_image_to_memory((const char *)atlas, width, height, 1, 8, &dataSize);
+
+            if (data != NULL) result = rgi_save_file_data(job->atlasFileName, (const unsigned char *)data, dataSize);
+            else result = RGI_ERROR_MEMORY_ALLOC;
+
+            RPNG_FREE(data);
+        }
+        else result = rgi_save_file_data(job->atlasFileName, atlas, width*height);
+
+        RL_FREE(atlas);
+
+        if (result == RGI_SUCCESS)
+        {
+            data = rgi_export_atlas_as_code_to_memory(iconset, job->atlasScales, job->atlasScaleCount, ATLAS_CELL_PADDING, &dataSize);
+
+            if (data != NULL) result = rgi_save_file_data(job->atlasCodeFileName, (const unsigned char *)data, dataSize);
+            else result = RGI_ERROR_MEMORY_ALLOC;
+
+            RL_FREE(data);
+        }
+
+        if (result != RGI_SUCCESS) strcpy(job->error, "Icons atlas files could not be saved");
+    }
+
+    if ((result == RGI_SUCCESS) && (job->error[0] == '\0')) job->success = true;
+    else if (job->error[0] == '\0') strcpy(job->error, "Output file could not be saved");
+
+    rgi_unload_iconset(trimmed);
+    RL_FREE(remap);
+    rgi_unmap_iconset(file);
+}
 
-    image.width = width;
-    image.height = height;
+// Get wall clock time counter (in seconds)
+// NOTE: raylib GetTime() requires window initialization, not available in command line mode
+static double GetTimeCounter(void)
+{
+#if defined(_WIN32)
+    return (double)clock()/CLOCKS_PER_SEC;      // NOTE: Windows clock() measures wall clock time
+#else
+    struct timespec time = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (double)time.tv_sec + (double)time.tv_nsec/1e9;
+#endif
+}
+#endif // PLATFORM_DESKTOP
+
+//--------------------------------------------------------------------------------------------
+// Auxiliar functions
+//--------------------------------------------------------------------------------------------
+
+// Expand icon bits into GRAY_ALPHA pixels (white, alpha 0 or 255)
+// NOTE: Pixels are written with the provided stride (in pixels) between lines
+static void ExpandIconBits(const unsigned int *icon, unsigned char *pixels, int stride)
+{
+    for (int y = 0; y < RAYGUI_ICON_SIZE; y++)
+    {
+        // Every data element contains two lines of 16 pixels, first line on lower bits
+        unsigned int line = (icon[y/2] >> ((y%2)*RAYGUI_ICON_SIZE)) & 0xffff;
+        unsigned char *linePixels = pixels + y*stride*2;
+
+        for (int x = 0; x < RAYGUI_ICON_SIZE; x++)
+        {
+            unsigned char value = (line & (1u << x))? 0xff : 0x00;
+            linePixels[x*2] = 0xff;             // Gray: always white, tinted on drawing
+            linePixels[x*2 + 1] = value;        // Alpha: pixel set or clear
+        }
+    }
+}
+
+// Load icons atlas texture from icons data
+// NOTE: All icons are expanded into a single GRAY_ALPHA texture, 32 icons per line
+static IconsAtlas LoadIconsAtlas(unsigned int *iconset, int iconCount)
+{
+    IconsAtlas atlas = { 0 };
+
+    atlas.iconCount = iconCount;
+    atlas.iconsPerLine = (iconCount < 32)? iconCount : 32;
+    atlas.values = (unsigned int *)RL_CALLOC(iconCount*RAYGUI_ICON_DATA_ELEMENTS, sizeof(unsigned int));
+    memcpy(atlas.values, iconset, iconCount*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+
+    int lines = iconCount/atlas.iconsPerLine;
+    if (iconCount%atlas.iconsPerLine > 0) lines++;
+
+    Image image = { 0 };
+    image.width = atlas.iconsPerLine*RAYGUI_ICON_SIZE;
+    image.height = lines*RAYGUI_ICON_SIZE;
     image.mipmaps = 1;
-    image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-    image.data = (Color *)calloc(image.width*image.height, sizeof(Color));
+    image.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+    image.data = (unsigned char *)RL_CALLOC(image.width*image.height*2, 1);
 
-    for (int i = 0; i < width*height/8; i++)
+    for (int n = 0; n < iconCount; n++)
     {
-        for (int k = 0; k < 8; k++)
+        int offsetX = (n%atlas.iconsPerLine)*RAYGUI_ICON_SIZE;
+        int offsetY = (n/atlas.iconsPerLine)*RAYGUI_ICON_SIZE;
+
+        ExpandIconBits(&iconset[n*RAYGUI_ICON_DATA_ELEMENTS], (unsigned char *)image.data + (offsetY*image.width + offsetX)*2, image.width);
+    }
+
+    atlas.texture = LoadTextureFromImage(image);
+    SetTextureFilter(atlas.texture, TEXTURE_FILTER_POINT);
+    UnloadImage(image);
+
+    return atlas;
+}
+
+// Unload icons atlas texture
+static void UnloadIconsAtlas(IconsAtlas atlas)
+{
+    UnloadTexture(atlas.texture);
+    RL_FREE(atlas.values);
+}
+
+// Update atlas texture regions for changed icons
+// NOTE: Icons data is compared with last uploaded data, only changed icons are uploaded again
+static int UpdateIconsAtlas(IconsAtlas *atlas, unsigned int *iconset)
+{
+    int updatedCount = 0;
+    unsigned char pixels[RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE*2] = { 0 };
+
+    for (int n = 0; n < atlas->iconCount; n++)
+    {
+        unsigned int *icon = &iconset[n*RAYGUI_ICON_DATA_ELEMENTS];
+        unsigned int *uploaded = &atlas->values[n*RAYGUI_ICON_DATA_ELEMENTS];
+
+        if (memcmp(icon, uploaded, RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int)) != 0)
         {
-            if (RGI_BIT_CHECK(bytes[i], k)) ((Color *)image.data)[i + k] = color;
+            ExpandIconBits(icon, pixels, RAYGUI_ICON_SIZE);
+            UpdateTextureRec(atlas->texture, (Rectangle){ (float)((n%atlas->iconsPerLine)*RAYGUI_ICON_SIZE),
+                (float)((n/atlas->iconsPerLine)*RAYGUI_ICON_SIZE), RAYGUI_ICON_SIZE, RAYGUI_ICON_SIZE }, pixels);
+
+            memcpy(uploaded, icon, RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+            updatedCount++;
         }
     }
 
-    return image;
+    return updatedCount;
+}
+
+// Draw one icon from atlas, using a single textured quad
+static void DrawIconFromAtlas(IconsAtlas atlas, int iconId, int posX, int posY, int pixelSize, Color color)
+{
+    if ((iconId < 0) || (iconId >= atlas.iconCount)) return;
+
+    Rectangle source = { (float)((iconId%atlas.iconsPerLine)*RAYGUI_ICON_SIZE), (float)((iconId/atlas.iconsPerLine)*RAYGUI_ICON_SIZE), RAYGUI_ICON_SIZE, RAYGUI_ICON_SIZE };
+    Rectangle dest = { (float)posX, (float)posY, (float)(RAYGUI_ICON_SIZE*pixelSize), (float)(RAYGUI_ICON_SIZE*pixelSize) };
+
+    DrawTexturePro(atlas.texture, source, dest, (Vector2){ 0, 0 }, 0.0f, color);
+}
+
+// Update icons selection panel, redrawing it only if required
+// NOTE: GuiToggleGroup() also processes selection input, so it must be called on any state
+// change that could modify the panel: icon under mouse, mouse button, selection, style or lock
+static bool UpdateIconsPanel(IconsPanelCache *panel, Vector2 position, const char *text, int *selectedIcon, int visualStyle, bool locked)
+{
+    int toggleSize = 18;
+    int padding = GuiGetStyle(TOGGLE, GROUP_PADDING);
+    Rectangle bounds = { position.x, position.y, (float)(32*toggleSize + 31*padding), (float)((RAYGUI_ICON_MAX_ICONS/32)*toggleSize + (RAYGUI_ICON_MAX_ICONS/32 - 1)*padding) };
+
+    // Get icon under mouse cursor, if any
+    int hoverIcon = -1;
+    Vector2 mousePosition = GetMousePosition();
+
+    if (CheckCollisionPointRec(mousePosition, bounds))
+    {
+        int col = (int)(mousePosition.x - bounds.x)/(toggleSize + padding);
+        int row = (int)(mousePosition.y - bounds.y)/(toggleSize + padding);
+        Rectangle toggleBounds = { bounds.x + col*(toggleSize + padding), bounds.y + row*(toggleSize + padding), (float)toggleSize, (float)toggleSize };
+
+        if (CheckCollisionPointRec(mousePosition, toggleBounds) && ((row*32 + col) < RAYGUI_ICON_MAX_ICONS)) hoverIcon = row*32 + col;
+    }
+
+    bool mouseButtonDown = IsMouseButtonDown(MOUSE_LEFT_BUTTON);
+
+    // Panel size could change with visual style, render texture must be reloaded
+    if ((panel->target.id == 0) || (panel->bounds.width != bounds.width) || (panel->bounds.height != bounds.height))
+    {
+        UnloadRenderTexture(panel->target);
+        panel->target = LoadRenderTexture((int)bounds.width, (int)bounds.height);
+        panel->valid = false;
+    }
+
+    if (panel->valid &&
+        (panel->bounds.x == bounds.x) && (panel->bounds.y == bounds.y) &&
+        (panel->hoverIcon == hoverIcon) &&
+        (panel->mouseButtonDown == mouseButtonDown) &&
+        (panel->selectedIcon == *selectedIcon) &&
+        (panel->visualStyle == visualStyle) &&
+        (panel->locked == locked))
+    {
+        panel->reuseCount++;
+        return false;
+    }
+
+    // Redraw panel into render texture, using a 2d camera to keep screen coordinates for input
+    int prevSelectedIcon = *selectedIcon;
+    Camera2D camera = { 0 };
+    camera.target = (Vector2){ bounds.x, bounds.y };
+    camera.zoom = 1.0f;
+
+    BeginTextureMode(panel->target);
+        ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
+        BeginMode2D(camera);
+            GuiToggleGroup((Rectangle){ bounds.x, bounds.y, (float)toggleSize, (float)toggleSize }, text, selectedIcon);
+        EndMode2D();
+    EndTextureMode();
+
+    // Store panel state for next update
+    // NOTE: Previous selection is stored, if changed by GuiToggleGroup() panel is redrawn on next update
+    panel->bounds = bounds;
+    panel->hoverIcon = hoverIcon;
+    panel->mouseButtonDown = mouseButtonDown;
+    panel->selectedIcon = prevSelectedIcon;
+    panel->visualStyle = visualStyle;
+    panel->locked = locked;
+    panel->valid = true;
+    panel->rebuildCount++;
+
+    return true;
+}
+
+// Draw icons selection panel cached texture
+static void DrawIconsPanel(IconsPanelCache panel)
+{
+    // NOTE: Render texture must be flipped vertically
+    DrawTextureRec(panel.target.texture, (Rectangle){ 0, 0, (float)panel.target.texture.width, -(float)panel.target.texture.height },
+        (Vector2){ panel.bounds.x, panel.bounds.y }, WHITE);
+}
+
+// Load undo journal with a memory budget (in bytes)
+static UndoJournal LoadUndoJournal(int memoryBudget)
+{
+    UndoJournal journal = { 0 };
+
+    journal.memoryBudget = memoryBudget;
+    journal.pendingIds = (int *)RL_CALLOC(RAYGUI_ICON_MAX_ICONS, sizeof(int));
+    journal.pendingMap = (bool *)RL_CALLOC(RAYGUI_ICON_MAX_ICONS, sizeof(bool));
+    journal.pendingValues = (unsigned int *)RL_CALLOC(RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS, sizeof(unsigned int));
+    journal.pendingNames = (char *)RL_CALLOC(RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_MAX_NAME_LENGTH, sizeof(char));
+
+    return journal;
+}
+
+// Unload undo journal
+static void UnloadUndoJournal(UndoJournal *journal)
+{
+    ResetUndoJournal(journal);
+
+    RL_FREE(journal->steps);
+    RL_FREE(journal->pendingIds);
+    RL_FREE(journal->pendingMap);
+    RL_FREE(journal->pendingValues);
+    RL_FREE(journal->pendingNames);
+
+    *journal = (UndoJournal){ 0 };
+}
+
+// Reset undo journal, all steps and pending changes removed
+static void ResetUndoJournal(UndoJournal *journal)
+{
+    for (int i = 0; i < journal->stepCount; i++) RL_FREE(journal->steps[i].deltas);
+
+    journal->stepCount = 0;
+    journal->currentStep = 0;
+    journal->memoryUsed = 0;
+
+    for (int i = 0; i < journal->pendingCount; i++) journal->pendingMap[journal->pendingIds[i]] = false;
+    journal->pendingCount = 0;
+}
+
+// Record icon state before being changed
+// NOTE: Only first record of an icon is kept until changes are committed
+static void RecordIconChange(UndoJournal *journal, int iconId)
+{
+    if ((iconId < 0) || (iconId >= RAYGUI_ICON_MAX_ICONS) || journal->pendingMap[iconId]) return;
+
+    memcpy(&journal->pendingValues[iconId*RAYGUI_ICON_DATA_ELEMENTS], &currentIcons[iconId*RAYGUI_ICON_DATA_ELEMENTS], RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+    memcpy(&journal->pendingNames[iconId*RAYGUI_ICON_MAX_NAME_LENGTH], guiIconsName[iconId], RAYGUI_ICON_MAX_NAME_LENGTH);
+
+    journal->pendingMap[iconId] = true;
+    journal->pendingIds[journal->pendingCount] = iconId;
+    journal->pendingCount++;
 }
 
-// Get icon bit data
-// NOTE: Bit data array grouped as unsigned int (RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE/32 elements)
-unsigned int *GetIconData(unsigned int *iconset, int iconId)
+// Commit recorded icon changes as one undo step
+// NOTE: Redo steps are discarded and oldest steps are dropped if memory budget is exceeded
+static bool CommitIconChanges(UndoJournal *journal)
 {
-    static unsigned int iconData[RAYGUI_ICON_DATA_ELEMENTS] = { 0 };
-    memset(iconData, 0, RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+    if (journal->pendingCount == 0) return false;
+
+    UndoStep step = { 0 };
+    step.deltas = (UndoIconDelta *)RL_CALLOC(journal->pendingCount, sizeof(UndoIconDelta));
+
+    for (int i = 0; i < journal->pendingCount; i++)
+    {
+        int iconId = journal->pendingIds[i];
+        UndoIconDelta *delta = &step.deltas[step.count];
+        unsigned int changes = 0;
+
+        for (int k = 0; k < RAYGUI_ICON_DATA_ELEMENTS; k++)
+        {
+            delta->values[k] = journal->pendingValues[iconId*RAYGUI_ICON_DATA_ELEMENTS + k]^currentIcons[iconId*RAYGUI_ICON_DATA_ELEMENTS + k];
+            changes |= delta->values[k];
+        }
+
+        for (int k = 0; k < RAYGUI_ICON_MAX_NAME_LENGTH; k++)
+        {
+            delta->name[k] = journal->pendingNames[iconId*RAYGUI_ICON_MAX_NAME_LENGTH + k]^guiIconsName[iconId][k];
+            changes |= (unsigned char)delta->name[k];
+        }
+
+        // Only icons really changed are stored
+        if (changes != 0)
+        {
+            delta->iconId = iconId;
+            step.count++;
+        }
+
+        journal->pendingMap[iconId] = false;
+    }
+
+    journal->pendingCount = 0;
+
+    if (step.count == 0)
+    {
+        RL_FREE(step.deltas);
+        return false;
+    }
+
+    // Discard steps available for redo
+    for (int i = journal->currentStep; i < journal->stepCount; i++)
+    {
+        journal->memoryUsed -= (journal->steps[i].count*sizeof(UndoIconDelta) + sizeof(UndoStep));
+        RL_FREE(journal->steps[i].deltas);
+    }
 
-    if (iconId < RAYGUI_ICON_MAX_ICONS) memcpy(iconData, &iconset[iconId*RAYGUI_ICON_DATA_ELEMENTS], RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+    journal->stepCount = journal->currentStep;
 
-    return iconData;
+    if (journal->stepCount >= journal->stepCapacity)
+    {
+        journal->stepCapacity = (journal->stepCapacity == 0)? 64 : journal->stepCapacity*2;
+        journal->steps = (UndoStep *)RL_REALLOC(journal->steps, journal->stepCapacity*sizeof(UndoStep));
+    }
+
+    journal->steps[journal->stepCount] = step;
+    journal->stepCount++;
+    journal->currentStep = journal->stepCount;
+    journal->memoryUsed += (step.count*sizeof(UndoIconDelta) + sizeof(UndoStep));
+
+    // Drop oldest steps while memory budget is exceeded (last step is always kept)
+    int droppedCount = 0;
+    while ((journal->memoryUsed > journal->memoryBudget) && ((journal->stepCount - droppedCount) > 1))
+    {
+        journal->memoryUsed -= (journal->steps[droppedCount].count*sizeof(UndoIconDelta) + sizeof(UndoStep));
+        RL_FREE(journal->steps[droppedCount].deltas);
+        droppedCount++;
+    }
+
+    if (droppedCount > 0)
+    {
+        memmove(journal->steps, journal->steps + droppedCount, (journal->stepCount - droppedCount)*sizeof(UndoStep));
+        journal->stepCount -= droppedCount;
+        journal->currentStep = journal->stepCount;
+    }
+
+    return true;
 }
 
-// Set icon bit data
-// NOTE: Data must be provided as unsigned int array (RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE/32 elements)
-void SetIconData(unsigned int *iconset, int iconId, unsigned int *data)
+// Apply undo step deltas to current icons
+// NOTE: XOR deltas are applied the same way for undo and redo
+static void ApplyUndoStep(UndoStep step)
 {
-    if (iconId < RAYGUI_ICON_MAX_ICONS) memcpy(&iconset[iconId*RAYGUI_ICON_DATA_ELEMENTS], data, RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+    for (int i = 0; i < step.count; i++)
+    {
+        int iconId = step.deltas[i].iconId;
+
+        for (int k = 0; k < RAYGUI_ICON_DATA_ELEMENTS; k++) currentIcons[iconId*RAYGUI_ICON_DATA_ELEMENTS + k] ^= step.deltas[i].values[k];
+        for (int k = 0; k < RAYGUI_ICON_MAX_NAME_LENGTH; k++) guiIconsName[iconId][k] ^= step.deltas[i].name[k];
+    }
 }
 
-// Set icon pixel value
-void SetIconPixel(unsigned int *iconset, int iconId, int x, int y)
+// Undo last step
+static bool UndoIconChanges(UndoJournal *journal)
 {
-    // This logic works for any RAYGUI_ICON_SIZE pixels icons,
-    // For example, in case of 16x16 pixels, every 2 lines fit in one unsigned int data element
-    RGI_BIT_SET(iconset[iconId*RAYGUI_ICON_DATA_ELEMENTS + y/(sizeof(unsigned int)*8/RAYGUI_ICON_SIZE)], x + (y%(sizeof(unsigned int)*8/RAYGUI_ICON_SIZE)*RAYGUI_ICON_SIZE));
+    CommitIconChanges(journal);     // Pending changes are committed first to be undone
+
+    if (journal->currentStep == 0) return false;
+
+    journal->currentStep--;
+    ApplyUndoStep(journal->steps[journal->currentStep]);
+
+    return true;
 }
 
-// Clear icon pixel value
-void ClearIconPixel(unsigned int *iconset, int iconId, int x, int y)
+// Redo next step
+static bool RedoIconChanges(UndoJournal *journal)
 {
-    // This logic works for any RAYGUI_ICON_SIZE pixels icons,
-    // For example, in case of 16x16 pixels, every 2 lines fit in one unsigned int data element
-    RGI_BIT_CLEAR(iconset[iconId*RAYGUI_ICON_DATA_ELEMENTS + y/(sizeof(unsigned int)*8/RAYGUI_ICON_SIZE)], x + (y%(sizeof(unsigned int)*8/RAYGUI_ICON_SIZE)*RAYGUI_ICON_SIZE));
+    CommitIconChanges(journal);     // Pending changes are committed first, discarding redo steps if any
+
+    if (journal->currentStep >= journal->stepCount) return false;
+
+    ApplyUndoStep(journal->steps[journal->currentStep]);
+    journal->currentStep++;
+
+    return true;
 }
 
-// Check icon pixel value
-bool CheckIconPixel(unsigned int *iconset, int iconId, int x, int y)
+// Draw screen render texture to screen, scaled if required
+// NOTE: Event waiting (idle mode) is applied on EndDrawing(), no frame processed until next input event
+static void DrawScreenTexture(RenderTexture2D target, bool screenSizeDouble, bool waitEvents)
 {
-    return (RGI_BIT_CHECK(iconset[iconId*8 + y/2], x + (y%2*16)));
+    BeginDrawing();
+        ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
+
+        // Draw render texture to screen
+        if (screenSizeDouble) DrawTexturePro(target.texture, (Rectangle){ 0, 0, (float)target.texture.width, -(float)target.texture.height }, (Rectangle){ 0, 0, (float)target.texture.width*2, (float)target.texture.height*2 }, (Vector2){ 0, 0 }, 0.0f, WHITE);
+        else DrawTextureRec(target.texture, (Rectangle){ 0, 0, (float)target.texture.width, -(float)target.texture.height }, (Vector2){ 0, 0 }, WHITE);
+
+#if defined(PLATFORM_DESKTOP)
+    if (waitEvents) EnableEventWaiting();
+    else DisableEventWaiting();
+#endif
+    EndDrawing();
+}
+
+// Check if any input event happened
+// NOTE: Only query functions used, input queues (keys/chars pressed) are not consumed
+static bool IsInputEventDetected(void)
+{
+    Vector2 mouseDelta = GetMouseDelta();
+
+    if ((mouseDelta.x != 0.0f) || (mouseDelta.y != 0.0f) || (GetMouseWheelMove() != 0.0f)) return true;
+
+    for (int button = MOUSE_BUTTON_LEFT; button <= MOUSE_BUTTON_BACK; button++)
+    {
+        if (IsMouseButtonDown(button) || IsMouseButtonReleased(button)) return true;
+    }
+
+    for (int key = KEY_SPACE; key <= KEY_KB_MENU; key++)
+    {
+        if (IsKeyDown(key) || IsKeyReleased(key)) return true;
+    }
+
+    return false;
+}
+
+// Load iconset file (.rgi) into current icons data and name ids
+// NOTE: File is memory mapped and validated, icons data and name ids are copied
+// directly from mapped file into current iconset, no intermediate allocations required
+static bool LoadIconsFile(const char *fileName)
+{
+    rgi_iconset_file file = rgi_map_iconset(fileName);
+
+    if (file.data == NULL)
+    {
+        LOG("WARNING: [%s] Iconset file not valid\n", fileName);
+        return false;
+    }
+
+    // NOTE: Icons not available in file (i.e. previous versions, up to 256 icons) are cleared
+    int count = (file.iconset.count < RAYGUI_ICON_MAX_ICONS)? file.iconset.count : RAYGUI_ICON_MAX_ICONS;
+
+    memset(currentIcons, 0, sizeof(currentIcons));
+    memset(guiIconsName, 0, sizeof(guiIconsName));
+    memcpy(currentIcons, file.iconset.values, count*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+    memcpy(guiIconsName, file.iconset.names, count*RAYGUI_ICON_MAX_NAME_LENGTH);
+
+    rgi_unmap_iconset(file);
+
+    return true;
+}
+
+// Load iconset image file (.png) into current icons data and name ids
+// NOTE: Image layout expected as exported by the tool: 16 icons per line, 1 pixel padding,
+// 1bit or 8bit image rows are streamed from rpng and thresholded into icons data as decoded,
+// so full image is never allocated, name ids are recovered from zTXt chunk
+static bool LoadIconsImageFile(const char *fileName)
+{
+    int fileDataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &fileDataSize);
+
+    if (fileData == NULL) return false;
+
+    // Check PNG chunks fit into file data before any reading (i.e. truncated file dropped)
+    // NOTE: Icons name ids chunk (zTXt) is read from the same buffer, chunks are walked up to IEND
+    if (!rpng_chunk_check_bounds_from_memory((const char *)fileData, fileDataSize))
+    {
+        LOG("WARNING: [%s] Icons image file not valid or truncated\n", fileName);
+        UnloadFileData(fileData);
+        return false;
+    }
+
+    IconsImageLoader loader = { 0 };
+    int rows = rpng_load_image_rows_from_memory((const char *)fileData, fileDataSize, LoadIconsImageRow, &loader, &loader.width, &loader.height, &loader.channels, &loader.bitDepth);
+
+    rgi_iconset iconset = loader.iconset;
+
+    // All icons rows must be decoded, image data checksum is validated once decoded
+    int lines = (iconset.count + 15)/16;
+    if ((iconset.values != NULL) && ((rows < 0) || (rows < lines*(RAYGUI_ICON_SIZE + 2))))
+    {
+        rgi_unload_iconset(iconset);
+        iconset = (rgi_iconset){ 0 };
+    }
+
+    bool result = (iconset.values != NULL);
+
+    if (result)
+    {
+        memset(currentIcons, 0, sizeof(currentIcons));
+        memset(guiIconsName, 0, sizeof(guiIconsName));
+        memcpy(currentIcons, iconset.values, iconset.count*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+
+        // Icons name ids are saved into PNG zTXt chunk, separated by ';'
+        char *iconsNames = rpng_chunk_read_comp_text_from_memory((const char *)fileData, "Description");
+
+        if (iconsNames != NULL)
+        {
+            const char *name = iconsNames;
+
+            for (int i = 0; (i < iconset.count) && (*name != '\0'); i++)
+            {
+                int length = 0;
+                while ((name[length] != ';') && (name[length] != '\0')) length++;
+
+                memcpy(guiIconsName[i], name, (length < RAYGUI_ICON_MAX_NAME_LENGTH)? length : (RAYGUI_ICON_MAX_NAME_LENGTH - 1));
+                name += length;
+                if (*name == ';') name++;
+            }
+
+            RPNG_FREE(iconsNames);
+        }
+
+        rgi_unload_iconset(iconset);
+    }
+    else LOG("WARNING: [%s] Icons image file not valid, expected layout: 16 icons per line, 1 pixel padding\n", fileName);
+
+    UnloadFileData(fileData);
+
+    return result;
+}
+
+// Load icons image row into icons data (rpng row callback)
+// NOTE: Image format and layout are checked on first row, decoding is stopped if not valid
+static bool LoadIconsImageRow(const char *row, int y, void *userData)
+{
+    IconsImageLoader *loader = (IconsImageLoader *)userData;
+
+    if (y == 0)
+    {
+        bool bits = ((loader->channels == 1) && (loader->bitDepth == 1));
+        if (!bits && (loader->bitDepth != 8)) return false;
+
+        // Icons count defined by image size, up to RAYGUI_ICON_MAX_ICONS
+        int count = (loader->height/(RAYGUI_ICON_SIZE + 2))*16;
+        if (count > RAYGUI_ICON_MAX_ICONS) count = RAYGUI_ICON_MAX_ICONS;
+        if ((count <= 0) || (loader->width < 16*(RAYGUI_ICON_SIZE + 2))) return false;
+
+        loader->iconset = rgi_gen_iconset(count);
+        if (loader->iconset.values == NULL) return false;
+    }
+
+    rgi_set_icons_from_image_row(loader->iconset, (const unsigned char *)row, y, loader->width, loader->channels, loader->bitDepth, 16, 1);
+
+    // Decoding stopped once all icons rows are set
+    int lines = (loader->iconset.count + 15)/16;
+
+    return (y + 1 < lines*(RAYGUI_ICON_SIZE + 2));
+}
+
+// Save current iconset file (.rgi)
+// NOTE: Iconset file is generated in one memory buffer, saved atomically to disk (temp file + rename)
+// or, on PLATFORM_WEB, the same buffer is directly downloaded, no MEMFS (emscripten memory filesystem) file required
+static bool SaveIconsFile(const char *fileName)
+{
+    int dataSize = 0;
+    unsigned char *data = rgi_save_iconset_to_memory(currentIconset, &dataSize);
+
+    if (data == NULL) return false;
+
+#if defined(PLATFORM_WEB)
+    // NOTE: Last argument must be a simple filename (can't use directories)
+    // NOTE: Included security check to (partially) avoid malicious code on PLATFORM_WEB
+    bool result = (strchr(fileName, '\'') == NULL);
+    if (result) emscripten_run_script(TextFormat("saveFileFromMemoryToDisk(%i, %i, '%s')", (int)(size_t)data, dataSize, GetFileName(fileName)));
+#else
+    bool result = (rgi_save_file_data(fileName, data, dataSize) == RGI_SUCCESS);
+    if (!result) LOG("WARNING: [%s] Iconset file could not be saved\n", fileName);
+#endif
+
+    RL_FREE(data);
+
+    return result;
+}
+
+// Export icons pack image as PNG to memory (16 icons per line, 1 pixel padding)
+// NOTE: Image is saved as 1bit grayscale, scanlines packed directly from icons data, icons name ids
+// zTXt chunk is generated in memory and written with image in one pass, returned data must be freed
+// by user with RPNG_FREE, thread-safe (no raylib functions or global state)
+static char *ExportIconsImageToMemory(rgi_iconset iconset, bool namesChunk, int *dataSize)
+{
+    char *data = NULL;
+    int width = 0;
+    int height = 0;
+    unsigned char *imageData = rgi_gen_image_bits(iconset, 16, 1, &width, &height);
+
+    *dataSize = 0;
+
+    if (imageData != NULL)
+    {
+        rpng_chunk chunk = { 0 };
+
+        if (namesChunk)
+        {
+            // Icons name ids saved into PNG zTXt chunk
+            char *iconsNames = LoadIconsNamesText(iconset);
+            chunk = rpng_chunk_gen_comp_text("Description", iconsNames);
+            RL_FREE(iconsNames);
+        }
+
+        data = rpng_save_image_with_chunks_to_memory((const char *)imageData, width, height, 1, 1, &chunk, namesChunk? 1 : 0, dataSize);
+
+        RPNG_FREE(chunk.data);
+        RL_FREE(imageData);
+    }
+
+    return data;
+}
+
+// Load icons name ids joined in one text, separated by ';'
+// NOTE: Text is used to save icons name ids into PNG zTXt chunk
+static char *LoadIconsNamesText(rgi_iconset iconset)
+{
+    char *text = (char *)RL_CALLOC(iconset.count*RGI_ICON_MAX_NAME_LENGTH + 1, 1);
+    char *textPtr = text;
+
+    for (int i = 0; i < iconset.count; i++)
+    {
+        const char *name = rgi_get_icon_name(iconset, i);
+        int length = 0;
+
+        if (name != NULL) while ((length < (RGI_ICON_MAX_NAME_LENGTH - 1)) && (name[length] != '\0')) length++;
+
+        if (length > 0) memcpy(textPtr, name, length);
+        textPtr[length] = ';';
+        textPtr += (length + 1);
+    }
+
+    return text;
 }